@@ -0,0 +1,316 @@
+/*
+最后修改:
+20261019
+测试环境:
+gcc11.2,c++11
+clang12.0,C++11
+msvc14.2,C++14
+*/
+#ifndef __OY_DYNAMICWAVELET__
+#define __OY_DYNAMICWAVELET__
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <numeric>
+#include <vector>
+
+#include "../TEST/std_bit.h"
+
+namespace OY {
+    namespace DynamicWaveLet {
+        using size_type = uint32_t;
+        struct Ignore {};
+        template <size_type LeafWords = 16, size_type Fanout = 16>
+        struct BitTree {
+            static_assert(LeafWords >= 2 && !(LeafWords & 1) && Fanout >= 4 && !(Fanout & 1), "LeafWords And Fanout Must Be Even");
+            static constexpr size_type leaf_bits = LeafWords << 6, max_height = 32;
+            struct leaf {
+                uint64_t m_bits[LeafWords];
+                size_type m_size, m_ones;
+            };
+            struct inner {
+                size_type m_child[Fanout], m_size[Fanout], m_ones[Fanout], m_cnt;
+            };
+            std::vector<leaf> m_leaves;
+            std::vector<inner> m_inners;
+            size_type m_root, m_height, m_size, m_ones;
+            static void _leaf_insert(leaf &x, size_type pos, bool bit) {
+                size_type w = pos >> 6, o = pos & 63;
+                for (size_type k = x.m_size >> 6; k > w; k--) x.m_bits[k] = x.m_bits[k] << 1 | x.m_bits[k - 1] >> 63;
+                uint64_t low = (uint64_t(1) << o) - 1;
+                x.m_bits[w] = (x.m_bits[w] & low) | (x.m_bits[w] & ~low) << 1 | uint64_t(bit) << o, x.m_size++, x.m_ones += bit;
+            }
+            static bool _leaf_erase(leaf &x, size_type pos) {
+                size_type w = pos >> 6, o = pos & 63, last = (x.m_size - 1) >> 6;
+                uint64_t low = (uint64_t(1) << o) - 1;
+                bool bit = x.m_bits[w] >> o & 1;
+                x.m_bits[w] = (x.m_bits[w] & low) | (x.m_bits[w] >> 1 & ~low);
+                for (size_type k = w + 1; k <= last; k++) x.m_bits[k - 1] |= x.m_bits[k] << 63, x.m_bits[k] >>= 1;
+                x.m_size--, x.m_ones -= bit;
+                return bit;
+            }
+            static size_type _leaf_rank(const leaf &x, size_type pos) {
+                size_type w = pos >> 6, res = 0;
+                for (size_type k = 0; k != w; k++) res += std::popcount(x.m_bits[k]);
+                return (pos & 63) ? res + std::popcount(x.m_bits[w] & ((uint64_t(1) << (pos & 63)) - 1)) : res;
+            }
+            void _collect(size_type cur, size_type depth, uint64_t *bits, size_type &pos) const {
+                if (depth == m_height) {
+                    const leaf &x = m_leaves[cur];
+                    for (size_type i = 0; i < x.m_size; i += 64) {
+                        size_type len = std::min<size_type>(64, x.m_size - i), o = pos & 63;
+                        uint64_t w = len == 64 ? x.m_bits[i >> 6] : x.m_bits[i >> 6] & ((uint64_t(1) << len) - 1);
+                        bits[pos >> 6] |= w << o;
+                        if (o) bits[(pos >> 6) + 1] |= w >> (64 - o);
+                        pos += len;
+                    }
+                } else
+                    for (size_type i = 0; i != m_inners[cur].m_cnt; i++) _collect(m_inners[cur].m_child[i], depth + 1, bits, pos);
+            }
+            size_type _new_leaf() { return m_leaves.push_back({}), m_leaves.size() - 1; }
+            size_type _new_inner() { return m_inners.push_back({}), m_inners.size() - 1; }
+            void _inner_insert(size_type cur, size_type slot, size_type child, size_type size, size_type ones) {
+                inner &x = m_inners[cur];
+                for (size_type i = x.m_cnt; i != slot; i--) x.m_child[i] = x.m_child[i - 1], x.m_size[i] = x.m_size[i - 1], x.m_ones[i] = x.m_ones[i - 1];
+                x.m_child[slot] = child, x.m_size[slot] = size, x.m_ones[slot] = ones, x.m_cnt++;
+            }
+            template <typename InitMapping = Ignore>
+            BitTree(size_type length = 0, InitMapping mapping = InitMapping()) { resize(length, mapping); }
+            template <typename InitMapping = Ignore>
+            void resize(size_type length, InitMapping mapping = InitMapping()) {
+                constexpr size_type leaf_fill = leaf_bits / 4 * 3, inner_fill = Fanout / 4 * 3;
+                m_leaves.clear(), m_inners.clear(), m_size = length, m_ones = 0, m_height = 0;
+                std::vector<size_type> cur, nxt;
+                size_type pos = 0;
+                do {
+                    size_type id = _new_leaf(), len = std::min(leaf_fill, m_size - pos);
+                    leaf &x = m_leaves[id];
+                    x.m_size = len;
+                    if constexpr (!std::is_same<InitMapping, Ignore>::value)
+                        for (size_type i = 0; i != len; i++)
+                            if (mapping(pos + i)) x.m_bits[i >> 6] |= uint64_t(1) << (i & 63), x.m_ones++;
+                    m_ones += x.m_ones, pos += len, cur.push_back(id);
+                } while (pos != m_size);
+                while (cur.size() > 1) {
+                    nxt.clear();
+                    for (size_type i = 0; i < cur.size(); i += inner_fill) {
+                        size_type id = _new_inner();
+                        for (size_type j = i, end = std::min<size_type>(i + inner_fill, cur.size()); j != end; j++)
+                            if (m_height)
+                                _inner_insert(id, j - i, cur[j], std::accumulate(m_inners[cur[j]].m_size, m_inners[cur[j]].m_size + m_inners[cur[j]].m_cnt, size_type(0)), std::accumulate(m_inners[cur[j]].m_ones, m_inners[cur[j]].m_ones + m_inners[cur[j]].m_cnt, size_type(0)));
+                            else
+                                _inner_insert(id, j - i, cur[j], m_leaves[cur[j]].m_size, m_leaves[cur[j]].m_ones);
+                        nxt.push_back(id);
+                    }
+                    std::swap(cur, nxt), m_height++;
+                }
+                m_root = cur[0];
+            }
+            void rebuild() {
+                std::vector<uint64_t> bits((m_size >> 6) + 2);
+                size_type pos = 0;
+                _collect(m_root, 0, bits.data(), pos);
+                resize(m_size, [&](size_type i) { return bits[i >> 6] >> (i & 63) & 1; });
+            }
+            size_type size() const { return m_size; }
+            size_type count() const { return m_ones; }
+            bool get(size_type pos) const {
+                size_type cur = m_root;
+                for (size_type d = 0; d != m_height; d++) {
+                    const inner &x = m_inners[cur];
+                    size_type i = 0;
+                    while (i + 1 < x.m_cnt && pos >= x.m_size[i]) pos -= x.m_size[i++];
+                    cur = x.m_child[i];
+                }
+                return m_leaves[cur].m_bits[pos >> 6] >> (pos & 63) & 1;
+            }
+            size_type rank1(size_type pos) const {
+                size_type cur = m_root, res = 0;
+                for (size_type d = 0; d != m_height; d++) {
+                    const inner &x = m_inners[cur];
+                    size_type i = 0;
+                    while (i + 1 < x.m_cnt && pos >= x.m_size[i]) res += x.m_ones[i], pos -= x.m_size[i++];
+                    cur = x.m_child[i];
+                }
+                return res + _leaf_rank(m_leaves[cur], pos);
+            }
+            size_type rank0(size_type pos) const { return pos - rank1(pos); }
+            void insert(size_type pos, bool bit) {
+                size_type path[max_height], slot[max_height], cur = m_root;
+                for (size_type d = 0; d != m_height; d++) {
+                    inner &x = m_inners[cur];
+                    size_type i = 0;
+                    while (i + 1 < x.m_cnt && pos > x.m_size[i]) pos -= x.m_size[i++];
+                    x.m_size[i]++, x.m_ones[i] += bit, path[d] = cur, slot[d] = i, cur = x.m_child[i];
+                }
+                _leaf_insert(m_leaves[cur], pos, bit), m_size++, m_ones += bit;
+                if (m_leaves[cur].m_size != leaf_bits) return;
+                // erase 不合并结点，所以分裂使叶子数达到重建后的两倍时整体重建，把结点数限制在 O(n / leaf_bits)
+                if (m_leaves.size() >= 2 * (m_size / (leaf_bits / 4 * 3) + 1)) return rebuild();
+                size_type split = _new_leaf();
+                leaf &x = m_leaves[cur], &y = m_leaves[split];
+                std::copy_n(x.m_bits + LeafWords / 2, LeafWords / 2, y.m_bits), std::fill_n(x.m_bits + LeafWords / 2, LeafWords / 2, 0);
+                y.m_size = x.m_size = leaf_bits / 2, y.m_ones = _leaf_rank(y, leaf_bits / 2), x.m_ones -= y.m_ones;
+                size_type left_size = x.m_size, left_ones = x.m_ones, right_size = y.m_size, right_ones = y.m_ones;
+                for (size_type d = m_height - 1; ~d; d--) {
+                    inner &p = m_inners[path[d]];
+                    p.m_size[slot[d]] = left_size, p.m_ones[slot[d]] = left_ones;
+                    _inner_insert(path[d], slot[d] + 1, split, right_size, right_ones);
+                    if (m_inners[path[d]].m_cnt != Fanout) return;
+                    size_type nsplit = _new_inner();
+                    inner &a = m_inners[path[d]], &b = m_inners[nsplit];
+                    std::copy_n(a.m_child + Fanout / 2, Fanout / 2, b.m_child), std::copy_n(a.m_size + Fanout / 2, Fanout / 2, b.m_size), std::copy_n(a.m_ones + Fanout / 2, Fanout / 2, b.m_ones);
+                    a.m_cnt = b.m_cnt = Fanout / 2;
+                    left_size = std::accumulate(a.m_size, a.m_size + a.m_cnt, size_type(0)), left_ones = std::accumulate(a.m_ones, a.m_ones + a.m_cnt, size_type(0));
+                    right_size = std::accumulate(b.m_size, b.m_size + b.m_cnt, size_type(0)), right_ones = std::accumulate(b.m_ones, b.m_ones + b.m_cnt, size_type(0));
+                    cur = path[d], split = nsplit;
+                }
+                size_type root = _new_inner();
+                _inner_insert(root, 0, cur, left_size, left_ones), _inner_insert(root, 1, split, right_size, right_ones);
+                m_root = root, m_height++;
+            }
+            bool erase(size_type pos) {
+                size_type path[max_height], slot[max_height], cur = m_root;
+                for (size_type d = 0; d != m_height; d++) {
+                    const inner &x = m_inners[cur];
+                    size_type i = 0;
+                    while (i + 1 < x.m_cnt && pos >= x.m_size[i]) pos -= x.m_size[i++];
+                    path[d] = cur, slot[d] = i, cur = x.m_child[i];
+                }
+                bool bit = _leaf_erase(m_leaves[cur], pos);
+                for (size_type d = 0; d != m_height; d++) m_inners[path[d]].m_size[slot[d]]--, m_inners[path[d]].m_ones[slot[d]] -= bit;
+                m_size--, m_ones -= bit;
+                return bit;
+            }
+        };
+        template <typename Tp, size_type LeafWords = 16, size_type Fanout = 16>
+        struct Table {
+            std::vector<BitTree<LeafWords, Fanout>> m_levels;
+            size_type m_size, m_alpha;
+            static bool _bit(Tp val, size_type i) { return val >> i & Tp(1); }
+            size_type _zero(size_type level) const { return m_size - m_levels[level].count(); }
+            template <typename InitMapping = Ignore>
+            Table(size_type length = 0, InitMapping mapping = InitMapping(), size_type alpha = sizeof(Tp) << 3) { resize(length, mapping, alpha); }
+            template <typename Iterator>
+            Table(Iterator first, Iterator last, size_type alpha = sizeof(Tp) << 3) { reset(first, last, alpha); }
+            template <typename InitMapping = Ignore>
+            void resize(size_type length, InitMapping mapping = InitMapping(), size_type alpha = sizeof(Tp) << 3) {
+                m_size = length, m_alpha = alpha, m_levels.clear(), m_levels.reserve(m_alpha);
+                std::vector<Tp> numbers(m_size);
+                if constexpr (!std::is_same<InitMapping, Ignore>::value)
+                    for (size_type i = 0; i != m_size; i++) numbers[i] = mapping(i);
+                for (size_type j = m_alpha - 1; ~j; j--) {
+                    m_levels.emplace_back(m_size, [&](size_type i) { return _bit(numbers[i], j); });
+                    std::stable_partition(numbers.begin(), numbers.end(), [&](const Tp &val) { return !_bit(val, j); });
+                }
+            }
+            template <typename Iterator>
+            void reset(Iterator first, Iterator last, size_type alpha = sizeof(Tp) << 3) {
+                resize(
+                    last - first, [&](size_type i) { return *(first + i); }, alpha);
+            }
+            size_type size() const { return m_size; }
+            Tp get(size_type i) const {
+                Tp ans = 0;
+                for (size_type level = 0, j = m_alpha - 1; level != m_alpha; level++, j--)
+                    if (m_levels[level].get(i))
+                        i = _zero(level) + m_levels[level].rank1(i), ans |= Tp(1) << j;
+                    else
+                        i = m_levels[level].rank0(i);
+                return ans;
+            }
+            void modify(size_type i, Tp val) {
+                size_type pos = i;
+                for (size_type level = 0; level != m_alpha; level++) {
+                    size_type zero = _zero(level), nxt = m_levels[level].get(pos) ? zero + m_levels[level].rank1(pos) : m_levels[level].rank0(pos);
+                    m_levels[level].erase(pos), pos = nxt;
+                }
+                pos = i;
+                for (size_type level = 0, j = m_alpha - 1; level != m_alpha; level++, j--) {
+                    bool bit = _bit(val, j);
+                    m_levels[level].insert(pos, bit);
+                    pos = bit ? _zero(level) + m_levels[level].rank1(pos) : m_levels[level].rank0(pos);
+                }
+            }
+            size_type count(size_type left, size_type right, Tp val) const {
+                right++;
+                for (size_type level = 0, j = m_alpha - 1; level != m_alpha; level++, j--) {
+                    size_type a = m_levels[level].rank1(left), b = m_levels[level].rank1(right);
+                    if (!_bit(val, j))
+                        left -= a, right -= b;
+                    else
+                        left = _zero(level) + a, right = _zero(level) + b;
+                }
+                return right - left;
+            }
+            size_type count(size_type left, size_type right, Tp minimum, Tp maximum) const {
+                size_type l1 = left, r1 = right + 1, l2 = left, r2 = right + 1, res = 0;
+                for (size_type level = 0, j = m_alpha - 1; level != m_alpha; level++, j--) {
+                    size_type zero = _zero(level), a1 = m_levels[level].rank1(l1), b1 = m_levels[level].rank1(r1), a2 = m_levels[level].rank1(l2), b2 = m_levels[level].rank1(r2), c1 = r1 - l1 - b1 + a1, c2 = r2 - l2 - b2 + a2;
+                    if (!_bit(minimum, j))
+                        l1 -= a1, r1 -= b1;
+                    else
+                        res -= c1, l1 = zero + a1, r1 = zero + b1;
+                    if (!_bit(maximum, j))
+                        l2 -= a2, r2 -= b2;
+                    else
+                        res += c2, l2 = zero + a2, r2 = zero + b2;
+                }
+                return r2 - l2 + res;
+            }
+            size_type rank(size_type left, size_type right, Tp val) const {
+                size_type ans = 0;
+                right++;
+                for (size_type level = 0, j = m_alpha - 1; level != m_alpha; level++, j--) {
+                    size_type a = m_levels[level].rank1(left), b = m_levels[level].rank1(right), c = right - left - b + a;
+                    if (!_bit(val, j))
+                        left -= a, right -= b;
+                    else
+                        ans += c, left = _zero(level) + a, right = _zero(level) + b;
+                }
+                return ans;
+            }
+            Tp minimum(size_type left, size_type right) const {
+                Tp ans = 0;
+                right++;
+                for (size_type level = 0, j = m_alpha - 1; level != m_alpha; level++, j--) {
+                    size_type a = m_levels[level].rank1(left), b = m_levels[level].rank1(right);
+                    if (right - left - b + a)
+                        left -= a, right -= b;
+                    else
+                        left = _zero(level) + a, right = _zero(level) + b, ans |= Tp(1) << j;
+                }
+                return ans;
+            }
+            Tp maximum(size_type left, size_type right) const {
+                Tp ans = 0;
+                right++;
+                for (size_type level = 0, j = m_alpha - 1; level != m_alpha; level++, j--) {
+                    size_type a = m_levels[level].rank1(left), b = m_levels[level].rank1(right);
+                    if (a == b)
+                        left -= a, right -= b;
+                    else
+                        left = _zero(level) + a, right = _zero(level) + b, ans |= Tp(1) << j;
+                }
+                return ans;
+            }
+            Tp quantile(size_type left, size_type right, size_type k) const {
+                Tp ans = 0;
+                right++;
+                for (size_type level = 0, j = m_alpha - 1; level != m_alpha; level++, j--) {
+                    size_type a = m_levels[level].rank1(left), b = m_levels[level].rank1(right), c = right - left - b + a;
+                    if (k < c)
+                        left -= a, right -= b;
+                    else
+                        left = _zero(level) + a, right = _zero(level) + b, k -= c, ans |= Tp(1) << j;
+                }
+                return ans;
+            }
+        };
+    }
+    template <typename Tp, DynamicWaveLet::size_type LeafWords = 16, DynamicWaveLet::size_type Fanout = 16>
+    using DynamicWaveLetTable = DynamicWaveLet::Table<Tp, LeafWords, Fanout>;
+}
+
+#endif
@@ -13,6 +13,7 @@ msvc14.2,C++14
 #include <cstdint>
 #include <functional>
 #include <numeric>
+#include <queue>
 #include <vector>
 
 #include "../TEST/std_bit.h"
@@ -157,6 +158,28 @@ namespace OY {
                 }
                 return ans;
             }
+            template <typename Callback>
+            void do_for_top_k(size_type left, size_type right, size_type k, Callback &&call) const {
+                struct state {
+                    size_type m_level, m_left, m_right;
+                    Tp m_val;
+                    bool operator<(const state &rhs) const { return m_right - m_left != rhs.m_right - rhs.m_left ? m_right - m_left < rhs.m_right - rhs.m_left : m_val > rhs.m_val; }
+                };
+                std::priority_queue<state> Q;
+                Q.push({0, left, right + 1, 0});
+                while (k && !Q.empty()) {
+                    state x = Q.top();
+                    Q.pop();
+                    if (x.m_level == m_alpha) {
+                        call(x.m_val, x.m_right - x.m_left), k--;
+                        continue;
+                    }
+                    node *cur = m_sub + m_stride * x.m_level;
+                    size_type j = m_alpha - 1 - x.m_level, a = _count_one(cur, x.m_left + 1), b = _count_one(cur, x.m_right + 1), zero = m_size - cur[m_stride - 1].m_sum;
+                    if (x.m_right - x.m_left != b - a) Q.push({x.m_level + 1, x.m_left - a, x.m_right - b, x.m_val});
+                    if (a != b) Q.push({x.m_level + 1, zero + a, zero + b, x.m_val | Tp(1) << j});
+                }
+            }
         };
         template <typename Tp, typename MaskType, size_type MAX_NODE>
         typename Table<Tp, MaskType, MAX_NODE>::node Table<Tp, MaskType, MAX_NODE>::s_buffer[MAX_NODE];
@@ -205,6 +228,10 @@ namespace OY {
             Tp minimum(size_type left, size_type right) const { return m_discretizer[m_table.minimum(left, right)]; }
             Tp maximum(size_type left, size_type right) const { return m_discretizer[m_table.maximum(left, right)]; }
             Tp quantile(size_type left, size_type right, size_type k) const { return m_discretizer[m_table.quantile(left, right, k)]; }
+            template <typename Callback>
+            void do_for_top_k(size_type left, size_type right, size_type k, Callback &&call) const {
+                m_table.do_for_top_k(left, right, k, [&](size_type val, size_type freq) { call(m_discretizer[val], freq); });
+            }
         };
         template <typename Tp, typename MaskType, size_type MAX_NODE>
         Tp Tree<Tp, MaskType, MAX_NODE>::s_buffer[MAX_NODE];
@@ -8,6 +8,7 @@
 namespace OY {
     template <typename _ModType>
     struct Barrett {
+        static constexpr size_t batch = std::is_same_v<_ModType, uint64_t> ? 16 : 64;
         _ModType m_P;
         __uint128_t m_Pinv;
         constexpr Barrett() = default;
@@ -82,6 +83,43 @@ namespace OY {
             }
             return res;
         }
+        template <typename _Init, typename _Mul, typename _Reduce>
+        void _pow_batch(const _ModType *__a, uint64_t __n, _ModType *__res, size_t __len, _Init &&__init, _Mul &&__mul, _Reduce &&__reduce) const {
+            // 每 batch 个数一组同步地做快速幂，组内各数的乘法互不依赖，可以填满乘法器的流水线
+            const _ModType one = __init(1);
+            for (size_t i = 0; i < __len; i += batch) {
+                const size_t m = std::min(batch, __len - i);
+                _ModType res[batch], b[batch];
+                for (size_t j = 0; j != batch; j++) res[j] = one, b[j] = j < m ? __init(mod(__a[i + j])) : 0;
+                for (uint64_t k = __n; k; k >>= 1) {
+                    if (k & 1)
+                        for (size_t j = 0; j != batch; j++) res[j] = __mul(res[j], b[j]);
+                    if (k > 1)
+                        for (size_t j = 0; j != batch; j++) b[j] = __mul(b[j], b[j]);
+                }
+                for (size_t j = 0; j != m; j++) __res[i + j] = __reduce(res[j]);
+            }
+        }
+        void multiply_batch(const _ModType *__a, const _ModType *__b, _ModType *__res, size_t __n) const {
+            for (size_t i = 0; i != __n; i++) __res[i] = multiply(__a[i], __b[i]);
+        }
+        void pow_batch(const _ModType *__a, uint64_t __n, _ModType *__res, size_t __len) const {
+            auto same = [](_ModType __x) { return __x; };
+            if constexpr (std::is_same_v<_ModType, uint64_t>)
+                if (m_P % 2) {
+                    // long double 运算无法流水，所以模数为奇数时改用蒙哥马利约减
+                    uint64_t pinv = m_P, ninv = -__uint128_t(m_P) % m_P;
+                    for (size_t i = 0; i != 5; i++) pinv *= uint64_t(2) - m_P * pinv;
+                    auto mul = [&](uint64_t __x, uint64_t __y) {
+                        __uint128_t val = __uint128_t(__x) * __y;
+                        uint64_t res = (val >> 64) - uint64_t((__uint128_t(uint64_t(val) * pinv) * m_P) >> 64);
+                        if (res >= m_P) res += m_P;
+                        return res;
+                    };
+                    return _pow_batch(__a, __n, __res, __len, [&](uint64_t __x) { return mul(__x, ninv); }, mul, [&](uint64_t __x) { return mul(__x, 1); });
+                }
+            _pow_batch(__a, __n, __res, __len, same, [&](uint64_t __x, uint64_t __y) { return multiply(__x, __y); }, same);
+        }
         template <typename _Tp>
         constexpr _Tp divide(_Tp __a) const {
             if (__a < m_P) return 0;
@@ -16,20 +16,20 @@ namespace OY {
         explicit BigFloat(_Tp __number) : m_shift(0), m_number(__number) { shrink(); }
         template <typename _Tp, std::enable_if_t<std::is_floating_point_v<_Tp>, bool> = true>
         explicit BigFloat(_Tp __number) : m_shift(std::ceil((std::log(std::abs(__number)) - std::log(_Tp(INT64_MAX))) / std::log(_Tp(_B)))), m_number(int64_t(__number / std::pow(_B, m_shift))) { shrink(); }
-        explicit BigFloat(const char *__number) { _fillWithString(*this, __number, std::strlen(__number)); }
-        explicit BigFloat(const std::string &__number) { _fillWithString(*this, __number.data(), __number.size()); }
+        explicit BigFloat(const char *__number) { _fillWithString(*this, __number, std::strlen(__number), true); }
+        explicit BigFloat(const std::string &__number) { _fillWithString(*this, __number.data(), __number.size(), true); }
         BigFloat(bint &&__number, int __shift = 0) : m_shift(__shift), m_number(std::move(__number)) { shrink(); }
         BigFloat(const bint &__number, int __shift = 0) : m_shift(__shift), m_number(__number) { shrink(); }
-        static void _fillWithString(bfloat &__a, const char *__number, uint32_t __length) {
+        static void _fillWithString(bfloat &__a, const char *__number, uint32_t __length, bool __arena) {
             uint32_t dot = __length;
             while (~--dot && __number[dot] != '.') {}
             if (!~dot) {
-                bint::_fillWithString(__a.m_number, __number, __length);
+                bint::_fillWithString(__a.m_number, __number, __length, __arena);
                 __a.m_shift = 0;
             } else {
                 char buffer[__length - 1];
                 std::copy_n(__number + dot + 1, __length - dot - 1, std::copy_n(__number, dot, buffer));
-                bint::_fillWithString(__a.m_number, buffer, __length - 1);
+                bint::_fillWithString(__a.m_number, buffer, __length - 1, __arena);
                 __a.m_shift = 1 + dot - __length;
             }
             __a.shrink();
@@ -88,11 +88,46 @@ namespace OY {
             }
             return res;
         }
-        bfloat sqrt(uint32_t __n) const {
-            if (__n == 1) return *this;
-            bfloat res(std::pow((long double)(*this), (long double)1 / __n));
-            uint32_t oldK = _K;
-            for (_K = 2; _K < oldK; _K *= 2) res = res * (__n - 1) / __n + (*this) / (res.pow(__n - 1) * __n);
+        bfloat _pow_estimate(int __num, uint32_t __den) const {
+            uint32_t top_length = std::min<uint32_t>(m_number.m_length, 3);
+            long double top = 0;
+            for (uint32_t i = 1; i <= top_length; i++) top = top * bint::_N + m_number.m_data[m_number.m_length - i];
+            int exp = m_shift + int(m_number.m_length - top_length) * _W, rem = (exp % int(__den) + int(__den)) % int(__den);
+            bfloat res(std::pow(top * std::pow((long double)_B, rem), (long double)__num / __den));
+            res.m_shift += (exp - rem) / int(__den) * __num;
+            return res;
+        }
+        bfloat inv() const {
+            int shift = (_K - int(m_number.m_length)) * _W;
+            bint a(shift >= 0 ? m_number << shift : m_number >> -shift);
+            bool negative = a.m_negative;
+            return bfloat(bint::_inv(a.setSign(false)).setSign(negative), shift - m_shift - _K * 2 * _W);
+        }
+        bfloat inv_sqrt() const {
+            uint32_t oldK = _K, precision[32], cnt = 0;
+            bfloat res(_pow_estimate(-1, 2));
+            for (uint32_t k = oldK; k > 2; k = k / 2 + 1) precision[cnt++] = k;
+            while (cnt) {
+                _K = precision[--cnt];
+                bfloat x(m_number, m_shift), err(bfloat(1) - x * (res * res));
+                res += res * err / 2;
+            }
+            _K = oldK;
+            return res;
+        }
+        bfloat sqrt(uint32_t __n = 2) const {
+            if (__n == 1 || !m_number.m_length) return *this;
+            if (__n == 2) {
+                uint32_t oldK = _K;
+                _K = oldK / 2 + 1;
+                bfloat y(inv_sqrt()), s(bfloat(m_number, m_shift) * y);
+                _K = oldK;
+                return s + y * (*this - s * s) / 2;
+            }
+            bfloat res(_pow_estimate(1, __n));
+            uint32_t oldK = _K, precision[32], cnt = 0;
+            for (uint32_t k = oldK; k > 2; k = k / 2 + 1) precision[cnt++] = k;
+            while (cnt) _K = precision[--cnt], res = res * (__n - 1) / __n + bfloat(m_number, m_shift) / (res.pow(__n - 1) * __n);
             _K = oldK;
             return res;
         }
@@ -194,8 +229,7 @@ namespace OY {
         friend _Istream &operator>>(_Istream &is, bfloat &self) {
             std::string number;
             is >> number;
-            if (self.m_number.m_length) bint::_free(self.m_number.m_data);
-            _fillWithString(self, number.data(), number.size());
+            _fillWithString(self, number.data(), number.size(), bint::_inArena(self.m_number.m_data));
             return is;
         }
         template <typename _Ostream>
@@ -7,9 +7,38 @@
 #include "Montgomery.h"
 
 namespace OY {
-    template <uint32_t _B = 10, uint32_t _W = 6, uint32_t _MAXN = 1 << 20, uint64_t _P = 9223372006790004737, uint64_t _R = 3>
+    template <uint32_t _B = 10, uint32_t _W = 6, uint32_t _MAXN = 1 << 20, uint64_t _P = 9223372006790004737, uint64_t _R = 3, uint32_t _S = 4>
     struct BigInt {
-        using bint = BigInt<_B, _W, _MAXN, _P, _R>;
+        using bint = BigInt<_B, _W, _MAXN, _P, _R, _S>;
+        static_assert(_S, "_S Must Be Positive");
+        struct Arena {
+            Arena *m_prev;
+            int *m_begin, *m_cursor, *m_end;
+            bool m_owned;
+            explicit Arena(uint32_t __capacity) : m_prev(s_arena), m_begin(new int[__capacity]), m_cursor(m_begin), m_end(m_begin + __capacity), m_owned(true) { s_arena = this; }
+            Arena(int *__buffer, uint32_t __capacity) : m_prev(s_arena), m_begin(__buffer), m_cursor(__buffer), m_end(__buffer + __capacity), m_owned(false) { s_arena = this; }
+            Arena(const Arena &) = delete;
+            ~Arena() {
+                s_arena = m_prev;
+                if (m_owned) delete[] m_begin;
+            }
+            bool contains(const int *__data) const { return __data >= m_begin && __data < m_end; }
+            int *allocate(uint32_t __length) {
+                if (uint32_t(m_end - m_cursor) < __length) return nullptr;
+                int *res = m_cursor;
+                m_cursor += __length;
+                return res;
+            }
+            void deallocate(int *__data, uint32_t __length) {
+                if (__data + __length == m_cursor) m_cursor = __data;
+            }
+            static void keep(bint &__a) {
+                if (!_inArena(__a.m_data)) return;
+                int *data = new int[__a.m_length];
+                std::copy_n(__a.m_data, __a.m_length, data);
+                _free(__a.m_data, __a.m_capacity), __a.m_data = data, __a.m_capacity = __a.m_length;
+            }
+        };
         static constexpr struct _Bases {
             uint64_t val[_W * 2 + 1];
             constexpr _Bases() : val{} {
@@ -18,15 +47,18 @@ namespace OY {
         } bases{};
         static constexpr uint32_t _N = bases.val[_W];
         static inline bint s_divThresh = bint(__int128_t(LLONG_MAX) / _N - 1);
+        static inline uint32_t s_divBasecase = 192;
         static inline Montgomery64 s_mg = Montgomery64(_P);
         static inline uint64_t s_roots[std::__bit_ceil(_MAXN / _W) << 1], s_dftBuffer[std::__bit_ceil(_MAXN / _W) << 2], s_rootSize = 1;
         static inline std::mt19937 s_rander;
+        static inline Arena *s_arena = nullptr;
         int *m_data;
-        uint32_t m_length;
+        uint32_t m_length, m_capacity;
         bool m_negative;
-        BigInt() : m_length(0), m_negative(false) {}
+        int m_buffer[_S];
+        BigInt() : m_data(m_buffer), m_length(0), m_capacity(_S), m_negative(false) {}
         template <typename _Tp, std::enable_if_t<std::is_integral_v<_Tp> | std::is_same_v<_Tp, __int128_t>, bool> = true>
-        explicit BigInt(_Tp __number) : m_length(0), m_negative(false) {
+        explicit BigInt(_Tp __number) : BigInt() {
             if (!__number) return;
             if (__number < _Tp(0)) {
                 m_negative = true;
@@ -38,17 +70,18 @@ namespace OY {
                 _Tp a(__number / _N), b(__number - a * _N);
                 *s_cursor++ = b, __number = a;
             }
-            std::copy(s_buffer, s_cursor, m_data = _malloc(m_length = s_cursor - s_buffer));
+            _reserve(s_cursor - s_buffer, false, true), std::copy(s_buffer, s_cursor, m_data), m_length = s_cursor - s_buffer;
         }
-        explicit BigInt(const char *__number) { _fillWithString(*this, __number, std::strlen(__number)); }
-        explicit BigInt(const std::string &__number) { _fillWithString(*this, __number.data(), __number.size()); }
-        BigInt(bint &&__other) : m_data(__other.m_data), m_length(__other.m_length), m_negative(__other.m_negative) { __other.m_length = 0, __other.m_negative = false; }
-        BigInt(const bint &__other) : m_length(__other.m_length), m_negative(__other.m_negative) {
-            if (m_length) std::copy_n(__other.m_data, m_length, m_data = _malloc(m_length));
-        }
-        ~BigInt() {
-            if (m_length) _free(m_data);
+        explicit BigInt(const char *__number) : BigInt() { _fillWithString(*this, __number, std::strlen(__number), true); }
+        explicit BigInt(const std::string &__number) : BigInt() { _fillWithString(*this, __number.data(), __number.size(), true); }
+        BigInt(bint &&__other) : BigInt() {
+            if (__other.m_data == __other.m_buffer)
+                _assign(__other, true), __other.m_length = 0, __other.m_negative = false;
+            else
+                m_data = __other.m_data, m_length = __other.m_length, m_capacity = __other.m_capacity, m_negative = __other.m_negative, __other.m_data = __other.m_buffer, __other.m_length = 0, __other.m_capacity = _S, __other.m_negative = false;
         }
+        BigInt(const bint &__other) : BigInt() { _assign(__other, true); }
+        ~BigInt() { _release(); }
         static char _fromInt(uint32_t __c) {
             if (__c < 10)
                 return '0' + __c;
@@ -65,13 +98,13 @@ namespace OY {
             else
                 return __c - 'a' + 10;
         }
-        static void _fillWithString(bint &__a, const char *__number, uint32_t __length) {
+        static void _fillWithString(bint &__a, const char *__number, uint32_t __length, bool __arena) {
             uint32_t cursor = std::find_if((__number[0] == '+' || __number[0] == '-') ? __number + 1 : __number, __number + __length, [](char c) { return c != '0'; }) - __number;
             if (cursor == __length)
                 __a.m_length = 0, __a.m_negative = false;
             else {
                 uint32_t quot = (__length - cursor) / _W, rem = (__length - cursor) - quot * _W;
-                __a.m_data = _malloc(__a.m_length = quot + (rem > 0)), __a.m_negative = __number[0] == '-';
+                __a._reserve(quot + (rem > 0), false, __arena), __a.m_length = quot + (rem > 0), __a.m_negative = __number[0] == '-';
                 uint32_t i = __a.m_length - 1;
                 if (rem) {
                     uint32_t digit = 0;
@@ -87,12 +120,38 @@ namespace OY {
         }
         static bint _empty(uint32_t __length, bool __negative) {
             bint res;
-            if (__length) res.m_data = _malloc(res.m_length = __length);
-            res.setSign(__negative);
+            res._reserve(__length, false, true), res.m_length = __length, res.setSign(__negative);
             return res;
         }
-        static int *_malloc(uint32_t __length) { return new int[__length]; }
-        static void _free(int *__data) { delete[] __data; }
+        static bool _inArena(const int *__data) {
+            for (Arena *it = s_arena; it; it = it->m_prev)
+                if (it->contains(__data)) return true;
+            return false;
+        }
+        static int *_malloc(uint32_t __length, bool __arena = true) {
+            if (__arena && s_arena)
+                if (int *res = s_arena->allocate(__length)) return res;
+            return new int[__length];
+        }
+        static void _free(int *__data, uint32_t __length) {
+            for (Arena *it = s_arena; it; it = it->m_prev)
+                if (it->contains(__data)) return it->deallocate(__data, __length);
+            delete[] __data;
+        }
+        void _release() {
+            if (m_data != m_buffer) _free(m_data, m_capacity);
+        }
+        // 只有新建的临时对象，或缓冲区本就位于 Arena 中的对象，才传入 __arena = true ；否则 Arena 析构后会留下悬垂指针
+        void _reserve(uint32_t __length, bool __keep, bool __arena) {
+            if (__length <= m_capacity) return;
+            uint32_t capacity = __keep ? std::max(__length, m_capacity + m_capacity / 2) : __length;
+            int *data = _malloc(capacity, __arena);
+            if (__keep) std::copy_n(m_data, m_length, data);
+            _release(), m_data = data, m_capacity = capacity;
+        }
+        void _assign(const bint &__other, bool __arena) {
+            _reserve(__other.m_length, false, __arena), std::copy_n(__other.m_data, __other.m_length, m_data), m_length = __other.m_length, m_negative = __other.m_negative;
+        }
         static void _prepareRoots(uint32_t __length) {
             if (s_rootSize == 1) s_roots[s_rootSize++] = s_mg.raw_init(1);
             while (s_rootSize < __length) {
@@ -123,13 +182,14 @@ namespace OY {
             for (uint32_t i = 0; i < __length; i++) __buffer[i] = s_mg.multiply(__buffer[i], inv);
             std::reverse(__buffer + 1, __buffer + __length);
         }
-        static bint _dft_product(const bint &__a, const bint &__b) {
-            uint32_t length = std::__bit_ceil(__a.m_length + __b.m_length - 1);
+        static void _dft_product(const bint &__a, const bint &__b, bint &res, bool __arena) {
+            uint32_t length = std::__bit_ceil(__a.m_length + __b.m_length - 1), res_length = __a.m_length + __b.m_length;
+            bool negative = __a.m_negative != __b.m_negative;
             _dft(s_dftBuffer, length, __a);
             _dft(s_dftBuffer + length, length, __b);
             for (uint32_t i = 0; i < length; i++) s_dftBuffer[i] = s_mg.multiply(s_dftBuffer[i], s_dftBuffer[i + length]);
             _idft(s_dftBuffer, length);
-            bint res(_empty(__a.m_length + __b.m_length, __a.m_negative != __b.m_negative));
+            res._reserve(res_length, false, __arena), res.m_length = res_length, res.m_negative = negative;
             uint64_t carry = 0;
             for (uint32_t i = 0; i + 1 < res.m_length; i++) {
                 uint64_t a = s_mg.reduce(s_dftBuffer[i]) + carry;
@@ -137,7 +197,6 @@ namespace OY {
             }
             res.m_data[res.m_length - 1] = carry;
             res.shrink();
-            return res;
         }
         static bint &_inplace_multiply(bint &__a, long long __b) {
             uint64_t carry = 0, i = 0;
@@ -145,7 +204,10 @@ namespace OY {
                 __a.opposite();
                 __b = -__b;
             }
-            while (i < __a.m_length) (__a.m_data[i] *= __b) += carry, carry = __a.m_data[i] / _N, __a.m_data[i++] -= carry * _N;
+            while (i < __a.m_length) {
+                uint64_t a = uint64_t(__a.m_data[i]) * __b + carry;
+                carry = a / _N, __a.m_data[i++] = a - carry * _N;
+            }
             return __a;
         }
         static bint _inplace_product(const bint &__a, long long __b) {
@@ -153,12 +215,12 @@ namespace OY {
             _inplace_multiply(res, __b);
             return res;
         }
-        static bint _self_multiply(const bint &__a) {
-            uint32_t length = std::__bit_ceil(__a.m_length * 2 - 1);
+        static void _self_multiply(const bint &__a, bint &res, bool __arena) {
+            uint32_t length = std::__bit_ceil(__a.m_length * 2 - 1), res_length = __a.m_length * 2;
             _dft(s_dftBuffer, length, __a);
             std::transform(s_dftBuffer, s_dftBuffer + length, s_dftBuffer, [](uint64_t x) { return s_mg.multiply(x, x); });
             _idft(s_dftBuffer, length);
-            bint res(_empty(__a.m_length * 2, false));
+            res._reserve(res_length, false, __arena), res.m_length = res_length, res.m_negative = false;
             uint64_t carry = 0;
             for (uint32_t i = 0; i + 1 < res.m_length; i++) {
                 uint64_t a = s_mg.reduce(s_dftBuffer[i]) + carry;
@@ -166,9 +228,12 @@ namespace OY {
             }
             res.m_data[res.m_length - 1] = carry;
             res.shrink();
+        }
+        static bint _self_product(const bint &__a) {
+            bint res;
+            if (__a.m_length) _self_multiply(__a, res, true);
             return res;
         }
-        static bint _self_product(const bint &__a) { return __a.m_length ? _self_multiply(__a) : bint(); }
         static bint _multiply_long_long(const bint &__a, long long __b) {
             uint64_t carry = 0, i = 0;
             while (i < __a.m_length) {
@@ -214,9 +279,7 @@ namespace OY {
                 uint32_t i = 0;
                 while (i < __a.m_length && ++(__a.m_data[i]) == _N) __a.m_data[i++] = 0;
                 if (i < __a.m_length) return __a;
-                __a = _empty(__a.m_length + 1, _Sign);
-                std::fill_n(__a.m_data, __a.m_length - 1, 0);
-                __a.m_data[__a.m_length - 1] = 1;
+                __a._reserve(__a.m_length + 1, true, _inArena(__a.m_data)), __a.m_data[__a.m_length++] = 1;
                 return __a;
             } else {
                 uint32_t i = 0;
@@ -228,27 +291,28 @@ namespace OY {
         static bint &_plus_minus_by(bint &__a, const bint &__b) {
             if (!__b.m_length) return __a;
             if (_Compare()(__a.m_negative, __b.m_negative)) {
-                if (__b.m_length <= __a.m_length && __a.m_data[__b.m_length - 1] + __b.m_data[__b.m_length - 1] < _N) {
-                    for (uint32_t i = 0, carry = 0; i < __b.m_length; i++)
-                        if (__a.m_data[i] += __b.m_data[i] + carry; (carry = __a.m_data[i] >= _N)) __a.m_data[i] -= _N;
-                    return __a;
-                }
-                bint res(_empty(std::max(__a.m_length, __b.m_length) + 1, __a.m_negative));
-                for (uint32_t i = 0, carry = 0; i < res.m_length; i++)
-                    if (res.m_data[i] = (i < __a.m_length ? __a.m_data[i] : 0) + (i < __b.m_length ? __b.m_data[i] : 0) + carry; (carry = res.m_data[i] >= _N)) res.m_data[i] -= _N;
-                return (__a = res).shrink();
+                uint32_t length = std::max(__a.m_length, __b.m_length) + 1, i = 0, carry = 0;
+                if (!__a.m_length) __a.m_negative = std::is_same_v<_Compare, std::not_equal_to<bool>> ? !__b.m_negative : __b.m_negative;
+                __a._reserve(length, true, _inArena(__a.m_data)), std::fill(__a.m_data + __a.m_length, __a.m_data + length, 0);
+                for (; i < __b.m_length; i++)
+                    if (__a.m_data[i] += __b.m_data[i] + carry; (carry = __a.m_data[i] >= int(_N))) __a.m_data[i] -= _N;
+                for (; carry; i++)
+                    if ((carry = ++__a.m_data[i] == _N)) __a.m_data[i] = 0;
+                __a.m_length = length;
+                return __a.shrink();
             } else {
                 if (int comp = absCompare(__a, __b); comp > 0) {
                     for (uint32_t i = 0, borrow = 0; i < __a.m_length; i++)
                         if (__a.m_data[i] -= (i < __b.m_length ? __b.m_data[i] : 0) + borrow; (borrow = __a.m_data[i] < 0)) __a.m_data[i] += _N;
                     return __a.shrink();
                 } else if (comp < 0) {
-                    bint res(_empty(__b.m_length, std::is_same_v<_Compare, std::not_equal_to<bool>> ? !__b.m_negative : __b.m_negative));
-                    for (uint32_t i = 0, borrow = 0; i < res.m_length; i++)
-                        if (res.m_data[i] = __b.m_data[i] - (i < __a.m_length ? __a.m_data[i] : 0) - borrow; (borrow = res.m_data[i] < 0)) res.m_data[i] += _N;
-                    return (__a = res).shrink();
+                    __a._reserve(__b.m_length, true, _inArena(__a.m_data)), std::fill(__a.m_data + __a.m_length, __a.m_data + __b.m_length, 0);
+                    for (uint32_t i = 0, borrow = 0; i < __b.m_length; i++)
+                        if (__a.m_data[i] = __b.m_data[i] - __a.m_data[i] - borrow; (borrow = __a.m_data[i] < 0)) __a.m_data[i] += _N;
+                    __a.m_length = __b.m_length, __a.m_negative = std::is_same_v<_Compare, std::not_equal_to<bool>> ? !__b.m_negative : __b.m_negative;
+                    return __a.shrink();
                 } else
-                    return __a = bint();
+                    return __a.m_length = 0, __a.setSign(false);
             }
         }
         template <typename _Compare, typename _Sign>
@@ -276,15 +340,102 @@ namespace OY {
             } else
                 return bint();
         }
+        static bint _slice(const bint &__a, uint32_t __first, uint32_t __last) {
+            bint res(_empty(std::min(__last, __a.m_length) - __first, false));
+            std::copy_n(__a.m_data + __first, res.m_length, res.m_data), res.shrink();
+            return res;
+        }
+        static void _cyclic_collect(uint32_t __length, bint &res) {
+            _idft(s_dftBuffer, __length);
+            res._reserve(__length, false, true), res.m_length = __length, res.m_negative = false;
+            uint64_t carry = 0;
+            for (uint32_t i = 0; i < __length; i++) {
+                uint64_t a = s_mg.reduce(s_dftBuffer[i]) + carry;
+                carry = a / _N, res.m_data[i] = a - carry * _N;
+            }
+            for (uint32_t i = 0; carry; i = i + 1 < __length ? i + 1 : 0) {
+                uint64_t a = res.m_data[i] + carry;
+                carry = a / _N, res.m_data[i] = a - carry * _N;
+            }
+            res.shrink();
+        }
+        static void _cyclic_product(const bint &__a, const bint &__b, uint32_t __length, bint &res) {
+            _dft(s_dftBuffer, __length, __a);
+            _dft(s_dftBuffer + __length, __length, __b);
+            for (uint32_t i = 0; i < __length; i++) s_dftBuffer[i] = s_mg.multiply(s_dftBuffer[i], s_dftBuffer[i + __length]);
+            _cyclic_collect(__length, res);
+        }
+        static bint _wrap_diff(const bint &__x, const bint &__y, uint32_t __length) {
+            bint mod(--(bint(1) << __length * _W)), res(__x - __y);
+            while (res.m_negative) res += mod;
+            while (res >= mod) res -= mod;
+            if (res.m_length >= __length) res -= mod;
+            return res;
+        }
+        static void _div_basecase(const bint &__a, const bint &__b, bint &__quot, bint &__rem) {
+            uint32_t n = __a.m_length, m = __b.m_length;
+            if (m == 1) {
+                long long carry = 0;
+                __quot = _empty(n, false);
+                for (uint32_t i = n - 1; ~i; i--) (carry *= _N) += __a.m_data[i], __quot.m_data[i] = carry / __b.m_data[0], carry -= __quot.m_data[i] * (long long)__b.m_data[0];
+                __quot.shrink(), __rem = bint(carry);
+                return;
+            }
+            const uint64_t f = _N / (uint64_t(__b.m_data[m - 1]) + 1);
+            bint u(_empty(n + 1, false)), v(_empty(m, false));
+            uint64_t carry = 0;
+            for (uint32_t i = 0; i < n; i++) {
+                uint64_t a = __a.m_data[i] * f + carry;
+                carry = a / _N, u.m_data[i] = a - carry * _N;
+            }
+            u.m_data[n] = carry, carry = 0;
+            for (uint32_t i = 0; i < m; i++) {
+                uint64_t a = __b.m_data[i] * f + carry;
+                carry = a / _N, v.m_data[i] = a - carry * _N;
+            }
+            __quot = _empty(n - m + 1, false);
+            const int64_t top = v.m_data[m - 1], second = v.m_data[m - 2];
+            for (uint32_t j = n - m; ~j; j--) {
+                int64_t num = int64_t(u.m_data[j + m]) * _N + u.m_data[j + m - 1], q = num / top, r = num - q * top;
+                while (q >= _N || q * second > r * _N + u.m_data[j + m - 2])
+                    if (q--, (r += top) >= _N) break;
+                int64_t borrow = 0, mul = 0;
+                for (uint32_t i = 0; i <= m; i++) {
+                    mul += i < m ? q * v.m_data[i] : 0;
+                    int64_t hi = mul / _N, cur = u.m_data[i + j] - (mul - hi * _N) - borrow;
+                    mul = hi;
+                    if ((borrow = cur < 0)) cur += _N;
+                    u.m_data[i + j] = cur;
+                }
+                if (borrow) {
+                    q--;
+                    for (uint32_t i = 0, c = 0; i <= m; i++)
+                        if (u.m_data[i + j] += (i < m ? v.m_data[i] : 0) + c; (c = u.m_data[i + j] >= int(_N))) u.m_data[i + j] -= _N;
+                }
+                __quot.m_data[j] = q;
+            }
+            __quot.shrink(), u.m_length = m, carry = 0;
+            for (uint32_t i = m - 1; ~i; i--) {
+                uint64_t a = carry * _N + u.m_data[i];
+                u.m_data[i] = a / f, carry = a - u.m_data[i] * f;
+            }
+            __rem = std::move(u.shrink());
+        }
         static bint _inv(const bint &__a) {
-            if (__a.m_length == 1)
-                return bint(bases.val[_W * 2] / __a.m_data[0]);
-            else if (__a.m_length == 2)
-                return bint(__int128_t(bases.val[_W * 2]) * bases.val[_W * 2] / (__int128_t(__a.m_data[1]) * _N + __a.m_data[0]));
-            else {
-                bint res(_inv(__a >> (__a.m_length - 1) / 2 * _W));
-                return ((res + res) << (__a.m_length - 1) / 2 * _W) - ((__a * (res * res)) >> (__a.m_length / 2 + 1) * 2 * _W);
+            uint32_t n = __a.m_length;
+            if (n <= std::max<uint32_t>(s_divBasecase, 5)) {
+                bint quot, rem;
+                _div_basecase(bint(1) << n * 2 * _W, __a, quot, rem);
+                return quot;
             }
+            uint32_t h = (n + 1) / 2 + 2, length = std::__bit_ceil(n + 4);
+            bint res(_inv(__a >> (n - h) * _W)), prod;
+            _cyclic_product(__a, res, length, prod);
+            bint err(_wrap_diff(bint(1) << (n + h) % length * _W, prod, length) >> (h - 1) * _W);
+            _dft(s_dftBuffer, length, err);
+            for (uint32_t i = 0; i < length; i++) s_dftBuffer[i] = s_mg.multiply(s_dftBuffer[i], s_dftBuffer[i + length]);
+            _cyclic_collect(length, prod);
+            return (res << (n - h) * _W) + (prod.setSign(err.m_negative) >> (h + 1) * _W);
         }
         static bint rand(uint32_t __length) {
             uint32_t quot = __length / _W, rem = __length - quot * _W;
@@ -300,6 +451,25 @@ namespace OY {
                 if (__a.m_data[i] != __b.m_data[i]) return __a.m_data[i] > __b.m_data[i] ? 1 : -1;
             return 0;
         }
+        static void _divide(const bint &__a, const bint &__b, bint &__quot, bint &__rem) {
+            uint32_t n = __a.m_length, m = __b.m_length;
+            if (m <= s_divBasecase || n - m <= s_divBasecase) return _div_basecase(__a, __b, __quot, __rem);
+            bint b(__b), bi(_inv(b.setSign(false))), q, prod;
+            uint32_t k = (n - m) / m, length = std::__bit_ceil(m + 2);
+            __quot = _empty(n - m + 1, false), std::fill_n(__quot.m_data, __quot.m_length, 0);
+            __rem = _empty(n - k * m, false), std::copy_n(__a.m_data + k * m, __rem.m_length, __rem.m_data);
+            for (uint32_t i = k; ~i; i--) {
+                if (i != k) __rem = (__rem << m * _W) + _slice(__a, i * m, (i + 1) * m);
+                q = __rem >> (m - 1) * _W, q = q * bi >> (m + 1) * _W;
+                _cyclic_product(b, q, length, prod);
+                bint fold(__rem.m_length > length ? (__rem >> length * _W) + _slice(__rem, 0, length) : __rem);
+                __rem = _wrap_diff(fold, prod, length);
+                while (__rem.m_negative) __rem += b, --q;
+                while (absCompare(__rem, b) >= 0) __rem -= b, ++q;
+                std::copy_n(q.m_data, q.m_length, __quot.m_data + i * m);
+            }
+            __quot.shrink();
+        }
         template <bool _Mod>
         static auto div_mod(const bint &__a, const bint &__b) {
             struct _res {
@@ -310,14 +480,11 @@ namespace OY {
                     return comp < 0 ? _res{{}, __a} : _res{bint(__a.m_negative == __b.m_negative ? 1 : -1), {}};
                 else
                     return comp < 0 ? bint() : bint(__a.m_negative == __b.m_negative ? 1 : -1);
-            uint32_t shift = __a.m_length > __b.m_length * 2 ? __a.m_length - __b.m_length * 2 : 0, n = __a.m_length + shift, m = __b.m_length + shift;
-            bint a(__a << shift * _W), b(__b << shift * _W), c, bi(_inv(b.setSign(false))), prod(b * bi), quot;
-            if (prod.m_length >= m * 2) prod -= b, --bi;
-            for (a.setSign(false); b <= a && (c = a * bi >> (m * 2 * _W)); a -= b * c, quot += c) {}
-            while (b <= a) a -= b, ++quot;
-            quot.setSign(__a.m_negative != __b.m_negative), a.setSign(__a.m_negative);
+            bint quot, rem;
+            _divide(__a, __b, quot, rem);
+            quot.setSign(__a.m_negative != __b.m_negative), rem.setSign(__a.m_negative);
             if constexpr (_Mod)
-                return _res{quot, shift ? a >> shift * _W : a};
+                return _res{quot, rem};
             else
                 return quot;
         }
@@ -335,11 +502,8 @@ namespace OY {
             return _res{res, __a.m_negative ? -carry : carry};
         }
         bint &shrink() {
-            if (!m_length) return *this;
             while (m_length && !m_data[m_length - 1]) m_length--;
-            if (m_length) return *this;
-            _free(m_data);
-            return setSign(false);
+            return m_length ? *this : setSign(false);
         }
         bint &opposite() { return setSign(!m_negative); }
         bint &setSign(bool __negative) {
@@ -347,13 +511,13 @@ namespace OY {
             return *this;
         }
         bint &operator=(bint &&__other) {
-            std::swap(m_length, __other.m_length), std::swap(m_data, __other.m_data), std::swap(m_negative, __other.m_negative);
+            if (m_data == m_buffer || __other.m_data == __other.m_buffer || (_inArena(__other.m_data) && !_inArena(m_data))) return *this = __other;
+            std::swap(m_length, __other.m_length), std::swap(m_data, __other.m_data), std::swap(m_capacity, __other.m_capacity), std::swap(m_negative, __other.m_negative);
             return *this;
         }
         bint &operator=(const bint &__other) {
-            if (m_length) _free(m_data);
-            if ((m_length = __other.m_length)) std::copy_n(__other.m_data, m_length, m_data = _malloc(m_length));
-            return setSign(__other.m_negative);
+            if (this != &__other) _assign(__other, _inArena(m_data));
+            return *this;
         }
         bint &operator++() { return _inc_dec<1, false>(*this); }
         bint &operator--() { return _inc_dec<-1, true>(*this); }
@@ -408,11 +572,26 @@ namespace OY {
         }
         bint &operator+=(const bint &__other) { return _plus_minus_by<std::equal_to<bool>>(*this, __other); }
         bint &operator-=(const bint &__other) { return _plus_minus_by<std::not_equal_to<bool>>(*this, __other); }
-        bint &operator*=(const bint &__other) { return absCompare(__other, s_divThresh) <= 0 ? *this *= (long long)__other : (*this = *this * __other); }
+        bint &operator*=(const bint &__other) {
+            if (absCompare(__other, s_divThresh) <= 0) return *this *= (long long)__other;
+            if (!m_length) return *this;
+            if (this == &__other)
+                _self_multiply(*this, *this, _inArena(m_data));
+            else
+                _dft_product(*this, __other, *this, _inArena(m_data));
+            return *this;
+        }
         bint &operator*=(long long __other) {
             if (!m_length) return *this;
-            if (!__other) return *this = bint();
-            return (m_data[m_length - 1] + 1) * std::abs(__other) < _N ? _inplace_multiply(*this, __other) : *this = _multiply_long_long(*this, __other);
+            if (!__other) return m_length = 0, setSign(false);
+            if (__other < 0) opposite(), __other = -__other;
+            uint64_t carry = 0;
+            for (uint32_t i = 0; i < m_length; i++) {
+                uint64_t a = uint64_t(m_data[i]) * __other + carry;
+                carry = a / _N, m_data[i] = a - carry * _N;
+            }
+            while (carry) _reserve(m_length + 1, true, _inArena(m_data)), m_data[m_length++] = carry % _N, carry /= _N;
+            return *this;
         }
         bint &operator/=(const bint &__other) { return absCompare(__other, s_divThresh) <= 0 ? *this /= (long long)__other : *this = div_mod<false>(*this, __other); }
         bint &operator/=(long long __other) {
@@ -425,9 +604,22 @@ namespace OY {
             for (uint32_t i = m_length - 1; ~i; i--) (carry *= _N) += m_data[i], m_data[i] = carry / __other, carry -= m_data[i] * __other;
             return shrink();
         }
-        bint &operator%=(const bint &__other) { return absCompare(__other, s_divThresh) <= 0 ? *this = bint(div_mod(*this, (long long)(__other)).rem) : div_mod<true>(*this, __other).rem; }
-        bint &operator%=(long long __other) { return *this = bint(divmod(*this, __other).rem); }
-        bint &operator<<=(uint32_t __shift) { return *this = *this << __shift; }
+        bint &operator%=(const bint &__other) { return absCompare(__other, s_divThresh) <= 0 ? *this = bint(div_mod(*this, (long long)(__other)).rem) : *this = div_mod<true>(*this, __other).rem; }
+        bint &operator%=(long long __other) { return *this = bint(div_mod(*this, __other).rem); }
+        bint &operator<<=(uint32_t __shift) {
+            if (!m_length) return *this;
+            uint32_t quot = __shift / _W, rem = __shift - quot * _W;
+            _reserve(m_length + quot + (rem > 0), true, _inArena(m_data));
+            std::copy_backward(m_data, m_data + m_length, m_data + m_length + quot), std::fill_n(m_data, quot, 0), m_length += quot;
+            if (!rem) return *this;
+            uint64_t carry = 0;
+            for (uint32_t i = quot; i < m_length; i++) {
+                uint64_t a = m_data[i] * bases.val[rem] + carry;
+                carry = a / _N, m_data[i] = a - carry * _N;
+            }
+            if (carry) m_data[m_length++] = carry;
+            return *this;
+        }
         bint &operator>>=(uint32_t __shift) {
             uint32_t quot = __shift / _W, rem = __shift - quot * _W;
             if (quot >= m_length || (quot == m_length - 1 && m_data[m_length - 1] < bases.val[rem])) return *this = bint();
@@ -475,13 +667,23 @@ namespace OY {
         friend bint operator+(const bint &__a, const bint &__b) {
             return _plus_minus<std::equal_to<bool>>(__a, __b, [](const bint &x) { return x; });
         }
+        friend bint operator+(bint &&__a, const bint &__b) { return std::move(__a += __b); }
+        friend bint operator+(const bint &__a, bint &&__b) { return std::move(__b += __a); }
+        friend bint operator+(bint &&__a, bint &&__b) { return std::move(__a += __b); }
         friend bint operator-(const bint &__a, const bint &__b) { return _plus_minus<std::not_equal_to<bool>>(__a, __b, std::negate<bint>()); }
+        friend bint operator-(bint &&__a, const bint &__b) { return std::move(__a -= __b); }
+        friend bint operator-(const bint &__a, bint &&__b) { return std::move((__b -= __a).opposite()); }
+        friend bint operator-(bint &&__a, bint &&__b) { return std::move(__a -= __b); }
         friend bint operator*(const bint &__a, const bint &__b) {
             if (!__a.m_length || !__b.m_length) return bint();
-            if (&__a == &__b) return _self_multiply(__a);
             if (absCompare(__a, s_divThresh) <= 0) return __b * (long long)__a;
             if (absCompare(__b, s_divThresh) <= 0) return __a * (long long)__b;
-            return _dft_product(__a, __b);
+            bint res;
+            if (&__a == &__b)
+                _self_multiply(__a, res, true);
+            else
+                _dft_product(__a, __b, res, true);
+            return res;
         }
         friend bint operator*(const bint &__a, long long __b) {
             if (!__a.m_length || !__b) return bint();
@@ -492,8 +694,9 @@ namespace OY {
         friend bint operator%(const bint &__a, const bint &__b) { return absCompare(__b, s_divThresh) <= 0 ? bint(div_mod(__a, (long long)(__b)).rem) : div_mod<true>(__a, __b).rem; }
         friend long long operator%(const bint &__a, long long __b) { return div_mod(__a, __b).rem; }
         friend bint operator<<(const bint &__a, uint32_t __shift) {
+            if (!__a.m_length) return bint();
             uint32_t quot = __shift / _W, rem = __shift - quot * _W;
-            bint res(_empty(__a.m_length ? __a.m_length + quot + (rem > 0) : 0, __a.m_negative));
+            bint res(_empty(__a.m_length + quot + (rem > 0), __a.m_negative));
             std::copy_n(__a.m_data, __a.m_length, std::fill_n(res.m_data, quot, 0));
             if (!rem) return res;
             uint64_t carry = 0;
@@ -523,8 +726,7 @@ namespace OY {
         friend _Istream &operator>>(_Istream &is, bint &self) {
             std::string number;
             is >> number;
-            if (self.m_length) _free(self.m_data);
-            _fillWithString(self, number.data(), number.size());
+            _fillWithString(self, number.data(), number.size(), _inArena(self.m_data));
             return is;
         }
         template <typename _Ostream>
@@ -0,0 +1,552 @@
+/*
+最后修改:
+20261019
+测试环境:
+gcc11.2,c++11
+clang12.0,C++11
+msvc14.2,C++14
+*/
+#ifndef __OY_BINARYBIGINT__
+#define __OY_BINARYBIGINT__
+
+#include <algorithm>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "Montgomery.h"
+
+// Montgomery.h 经 Barrett.h 引入了 <bit> ，垫片须放在其后才能检测到标准库已提供的函数
+#include "../TEST/std_bit.h"
+
+namespace OY {
+    namespace BINBIG {
+        using size_type = uint32_t;
+        using limb = uint64_t;
+        using vec = std::vector<limb>;
+        struct Threshold {
+            static inline size_type s_karatsuba = 32, s_toom3 = 256, s_ntt = 1024, s_newton = 48, s_radix = 32;
+        };
+        inline limb _add_n(limb *r, const limb *a, const limb *b, size_type n) {
+            limb carry = 0;
+            for (size_type i = 0; i != n; i++) {
+                limb x = a[i] + carry;
+                carry = x < carry, r[i] = x + b[i], carry += r[i] < x;
+            }
+            return carry;
+        }
+        inline limb _add(limb *r, const limb *a, size_type an, const limb *b, size_type bn) {
+            limb carry = _add_n(r, a, b, bn);
+            for (size_type i = bn; i != an; i++) r[i] = a[i] + carry, carry = r[i] < carry;
+            return carry;
+        }
+        inline limb _sub_n(limb *r, const limb *a, const limb *b, size_type n) {
+            limb borrow = 0;
+            for (size_type i = 0; i != n; i++) {
+                limb x = a[i], y = b[i] + borrow;
+                borrow = (y < borrow) | (x < y), r[i] = x - y;
+            }
+            return borrow;
+        }
+        inline limb _sub(limb *r, const limb *a, size_type an, const limb *b, size_type bn) {
+            limb borrow = _sub_n(r, a, b, bn);
+            for (size_type i = bn; i != an; i++) r[i] = a[i] - borrow, borrow = a[i] < borrow;
+            return borrow;
+        }
+        inline limb _mul_1(limb *r, const limb *a, size_type n, limb b) {
+            limb carry = 0;
+            for (size_type i = 0; i != n; i++) {
+                __uint128_t x = __uint128_t(a[i]) * b + carry;
+                r[i] = limb(x), carry = limb(x >> 64);
+            }
+            return carry;
+        }
+        inline limb _addmul_1(limb *r, const limb *a, size_type n, limb b) {
+            limb carry = 0;
+            for (size_type i = 0; i != n; i++) {
+                __uint128_t x = __uint128_t(a[i]) * b + r[i] + carry;
+                r[i] = limb(x), carry = limb(x >> 64);
+            }
+            return carry;
+        }
+        inline limb _submul_1(limb *r, const limb *a, size_type n, limb b) {
+            limb borrow = 0;
+            for (size_type i = 0; i != n; i++) {
+                __uint128_t x = __uint128_t(a[i]) * b + borrow;
+                limb lo = limb(x);
+                borrow = limb(x >> 64) + (r[i] < lo), r[i] -= lo;
+            }
+            return borrow;
+        }
+        inline limb _divmod_1(limb *q, const limb *a, size_type n, limb d) {
+            __uint128_t rem = 0;
+            for (size_type i = n - 1; ~i; i--) {
+                rem = rem << 64 | a[i];
+                q[i] = limb(rem / d), rem %= d;
+            }
+            return limb(rem);
+        }
+        inline void _trim(vec &x) {
+            while (x.size() && !x.back()) x.pop_back();
+        }
+        inline int _cmp(const vec &x, const vec &y) {
+            if (x.size() != y.size()) return x.size() < y.size() ? -1 : 1;
+            for (size_type i = x.size() - 1; ~i; i--)
+                if (x[i] != y[i]) return x[i] < y[i] ? -1 : 1;
+            return 0;
+        }
+        inline vec _vadd(const vec &x, const vec &y) {
+            if (x.size() < y.size()) return _vadd(y, x);
+            vec res(x.size() + 1);
+            res.back() = _add(res.data(), x.data(), x.size(), y.data(), y.size()), _trim(res);
+            return res;
+        }
+        inline vec _vsub(const vec &x, const vec &y) {
+            vec res(x.size());
+            _sub(res.data(), x.data(), x.size(), y.data(), y.size()), _trim(res);
+            return res;
+        }
+        inline vec _vshl(const vec &x, uint64_t k) {
+            if (x.empty()) return {};
+            size_type q = k / 64, s = k % 64;
+            vec res(x.size() + q + 1);
+            if (s) {
+                for (size_type i = 0; i != x.size(); i++) res[i + q] |= x[i] << s, res[i + q + 1] = x[i] >> (64 - s);
+            } else
+                std::copy(x.begin(), x.end(), res.begin() + q);
+            _trim(res);
+            return res;
+        }
+        inline vec _vshr(const vec &x, uint64_t k) {
+            if (k >= uint64_t(x.size()) * 64) return {};
+            size_type q = k / 64, s = k % 64;
+            vec res(x.size() - q);
+            if (s) {
+                for (size_type i = 0; i != res.size(); i++) res[i] = x[i + q] >> s | (i + q + 1 < x.size() ? x[i + q + 1] << (64 - s) : 0);
+            } else
+                std::copy(x.begin() + q, x.end(), res.begin());
+            _trim(res);
+            return res;
+        }
+        struct _snum {
+            vec m_mag;
+            bool m_neg;
+        };
+        inline _snum _sadd(const _snum &x, const _snum &y) {
+            if (x.m_neg == y.m_neg) return {_vadd(x.m_mag, y.m_mag), x.m_neg};
+            int c = _cmp(x.m_mag, y.m_mag);
+            if (c >= 0) return {_vsub(x.m_mag, y.m_mag), c && x.m_neg};
+            return {_vsub(y.m_mag, x.m_mag), y.m_neg};
+        }
+        inline _snum _ssub(const _snum &x, const _snum &y) { return _sadd(x, {y.m_mag, !y.m_neg && y.m_mag.size()}); }
+        inline void _divexact_3(vec &x) {
+            constexpr limb inv = 0xaaaaaaaaaaaaaaab;
+            limb c = 0;
+            for (auto &a : x) {
+                limb s = a - c;
+                c = a < c, a = s * inv, c += (a > limb(-1) / 3) + (a > limb(-1) / 3 * 2);
+            }
+            _trim(x);
+        }
+        inline void _half(vec &x) {
+            for (size_type i = 0; i != x.size(); i++) x[i] = x[i] >> 1 | (i + 1 < x.size() ? x[i + 1] << 63 : 0);
+            _trim(x);
+        }
+        inline void _mul(limb *r, const limb *a, size_type an, const limb *b, size_type bn);
+        inline vec _vmul(const vec &x, const vec &y) {
+            if (x.empty() || y.empty()) return {};
+            vec res(x.size() + y.size());
+            if (x.size() >= y.size())
+                _mul(res.data(), x.data(), x.size(), y.data(), y.size());
+            else
+                _mul(res.data(), y.data(), y.size(), x.data(), x.size());
+            _trim(res);
+            return res;
+        }
+        inline void _add_at(limb *r, size_type rn, const vec &x, size_type offset) {
+            if (x.size()) _add(r + offset, r + offset, rn - offset, x.data(), x.size());
+        }
+        inline void _mul_basecase(limb *r, const limb *a, size_type an, const limb *b, size_type bn) {
+            r[an] = _mul_1(r, a, an, b[0]);
+            for (size_type j = 1; j != bn; j++) r[an + j] = _addmul_1(r + j, a, an, b[j]);
+        }
+        inline void _karatsuba(limb *r, const limb *a, size_type an, const limb *b, size_type bn) {
+            size_type h = (an + 1) / 2, b0n = std::min(bn, h);
+            vec a0(a, a + h), a1(a + h, a + an), b0(b, b + b0n), b1(b + b0n, b + bn);
+            _trim(a0), _trim(a1), _trim(b0), _trim(b1);
+            vec z0 = _vmul(a0, b0), z2 = _vmul(a1, b1), z1 = _vsub(_vsub(_vmul(_vadd(a0, a1), _vadd(b0, b1)), z0), z2);
+            std::fill_n(r, an + bn, 0);
+            std::copy(z0.begin(), z0.end(), r), std::copy(z2.begin(), z2.end(), r + h * 2), _add_at(r, an + bn, z1, h);
+        }
+        inline void _toom3(limb *r, const limb *a, size_type an, const limb *b, size_type bn) {
+            size_type k = (an + 2) / 3;
+            auto part = [k](const limb *x, size_type xn, size_type i) {
+                vec res(x + std::min(xn, k * i), x + std::min(xn, k * (i + 1)));
+                _trim(res);
+                return res;
+            };
+            vec a0 = part(a, an, 0), a1 = part(a, an, 1), a2 = part(a, an, 2), b0 = part(b, bn, 0), b1 = part(b, bn, 1), b2 = part(b, bn, 2);
+            auto eval = [](const vec &x0, const vec &x1, const vec &x2, vec &p1, _snum &m1, _snum &m2) {
+                vec x02 = _vadd(x0, x2);
+                _snum t = _ssub({_vshl(x2, 1), false}, {x1, false});
+                p1 = _vadd(x02, x1), m1 = _ssub({x02, false}, {x1, false}), m2 = _sadd({_vshl(t.m_mag, 1), t.m_neg}, {x0, false});
+            };
+            vec ap1, bp1;
+            _snum am1, am2, bm1, bm2;
+            eval(a0, a1, a2, ap1, am1, am2), eval(b0, b1, b2, bp1, bm1, bm2);
+            vec v0 = _vmul(a0, b0), vinf = _vmul(a2, b2);
+            _snum v1{_vmul(ap1, bp1), false}, vm1{_vmul(am1.m_mag, bm1.m_mag), am1.m_neg != bm1.m_neg}, vm2{_vmul(am2.m_mag, bm2.m_mag), am2.m_neg != bm2.m_neg};
+            if (vm1.m_mag.empty()) vm1.m_neg = false;
+            if (vm2.m_mag.empty()) vm2.m_neg = false;
+            _snum r3 = _ssub(vm2, v1), r1 = _ssub(v1, vm1), r2 = _ssub(vm1, {v0, false});
+            _divexact_3(r3.m_mag), _half(r1.m_mag);
+            r3 = _ssub(r2, r3), _half(r3.m_mag), r3 = _sadd(r3, {_vshl(vinf, 1), false});
+            r2 = _ssub(_sadd(r2, r1), {vinf, false}), r1 = _ssub(r1, r3);
+            std::fill_n(r, an + bn, 0);
+            std::copy(v0.begin(), v0.end(), r), std::copy(vinf.begin(), vinf.end(), r + k * 4);
+            _add_at(r, an + bn, r1.m_mag, k), _add_at(r, an + bn, r2.m_mag, k * 2), _add_at(r, an + bn, r3.m_mag, k * 3);
+        }
+        template <uint64_t P, uint64_t R>
+        struct _NTT {
+            static inline Montgomery64 s_mg = Montgomery64(P);
+            static inline vec s_roots{0, s_mg.raw_init(1)};
+            static void _prepare_roots(size_type length) {
+                while (s_roots.size() < length) {
+                    size_type cur = s_roots.size();
+                    const uint64_t wn = s_mg.pow(s_mg.raw_init(R), (P - 1) / (cur * 2));
+                    s_roots.resize(cur * 2);
+                    for (size_type i = cur; i != cur * 2; i += 2) s_roots[i] = s_roots[i / 2], s_roots[i + 1] = s_mg.multiply(s_roots[i / 2], wn);
+                }
+            }
+            static void _dft(uint64_t *buffer, size_type length, const limb *a, size_type an) {
+                for (size_type i = 0; i != an; i++) buffer[i] = s_mg.raw_init(a[i]);
+                std::fill(buffer + an, buffer + length, 0);
+                for (size_type l = length / 2; l; l /= 2)
+                    for (size_type i = 0; i != length; i += l * 2)
+                        for (size_type j = 0; j != l; j++) {
+                            auto x = buffer[i + j], y = buffer[i + j + l];
+                            buffer[i + j] = s_mg.plus(x, y), buffer[i + j + l] = s_mg.multiply(s_roots[j + l], s_mg.minus(x, y));
+                        }
+            }
+            static void _idft(uint64_t *buffer, size_type length) {
+                for (size_type l = 1; l != length; l *= 2)
+                    for (size_type i = 0; i != length; i += l * 2)
+                        for (size_type j = 0; j != l; j++) {
+                            auto x = buffer[i + j], y = s_mg.multiply(s_roots[j + l], buffer[i + j + l]);
+                            buffer[i + j] = s_mg.plus(x, y), buffer[i + j + l] = s_mg.minus(x, y);
+                        }
+                std::reverse(buffer + 1, buffer + length);
+            }
+            static void convolve(uint64_t *res, const limb *a, size_type an, const limb *b, size_type bn, size_type length) {
+                _prepare_roots(length);
+                vec buffer(length);
+                _dft(res, length, a, an), _dft(buffer.data(), length, b, bn);
+                const uint64_t inv = s_mg.pow(s_mg.raw_init(length), P - 2);
+                for (size_type i = 0; i != length; i++) res[i] = s_mg.multiply(s_mg.multiply(res[i], buffer[i]), inv);
+                _idft(res, length);
+                for (size_type i = 0; i != length; i++) res[i] = s_mg.reduce(res[i]);
+            }
+        };
+        static constexpr uint64_t P1 = 4611615649683210241, P2 = 4611613450659954689, P3 = 4611549678985543681;
+        using _NTT1 = _NTT<P1, 11>;
+        using _NTT2 = _NTT<P2, 3>;
+        using _NTT3 = _NTT<P3, 19>;
+        inline void _ntt_mul(limb *r, const limb *a, size_type an, const limb *b, size_type bn) {
+            size_type length = std::bit_ceil(an + bn - 1);
+            vec c1(length), c2(length), c3(length);
+            _NTT1::convolve(c1.data(), a, an, b, bn, length), _NTT2::convolve(c2.data(), a, an, b, bn, length), _NTT3::convolve(c3.data(), a, an, b, bn, length);
+            const auto &mg2 = _NTT2::s_mg, &mg3 = _NTT3::s_mg;
+            static const uint64_t inv12 = mg2.pow(mg2.raw_init(P1), P2 - 2), p1_3 = mg3.raw_init(P1), inv123 = mg3.pow(mg3.multiply(p1_3, mg3.raw_init(P2)), P3 - 2);
+            static const __uint128_t p12 = __uint128_t(P1) * P2;
+            limb acc0 = 0, acc1 = 0, acc2 = 0;
+            for (size_type i = 0; i != an + bn; i++) {
+                if (i + 1 < an + bn) {
+                    uint64_t x1 = c1[i], x2 = c2[i], x3 = c3[i];
+                    uint64_t t2 = mg2.multiply(mg2.minus(x2, x1 >= P2 ? x1 - P2 : x1), inv12);
+                    uint64_t t3 = mg3.multiply(mg3.minus(mg3.minus(x3, x1 >= P3 ? x1 - P3 : x1), mg3.multiply(t2 >= P3 ? t2 - P3 : t2, p1_3)), inv123);
+                    __uint128_t low = __uint128_t(P1) * t2 + x1, mid = __uint128_t(limb(p12)) * t3, high = __uint128_t(limb(p12 >> 64)) * t3;
+                    __uint128_t sum = low + mid;
+                    limb v0 = limb(sum), v1 = limb(sum >> 64), v2 = sum < low, c;
+                    v1 += limb(high), c = v1 < limb(high), v2 += limb(high >> 64) + c;
+                    acc0 += v0, c = acc0 < v0;
+                    acc1 += c, c = acc1 < c, acc2 += c;
+                    acc1 += v1, c = acc1 < v1, acc2 += v2 + c;
+                }
+                r[i] = acc0, acc0 = acc1, acc1 = acc2, acc2 = 0;
+            }
+        }
+        inline void _mul(limb *r, const limb *a, size_type an, const limb *b, size_type bn) {
+            if (bn < std::max<size_type>(Threshold::s_karatsuba, 4)) return _mul_basecase(r, a, an, b, bn);
+            if (bn >= Threshold::s_ntt) return _ntt_mul(r, a, an, b, bn);
+            if (an >= bn * 2) {
+                _mul(r, a, bn, b, bn), std::fill(r + bn * 2, r + an + bn, 0);
+                vec tmp(bn * 2);
+                for (size_type i = bn; i < an; i += bn) {
+                    size_type len = std::min(bn, an - i);
+                    if (len == bn)
+                        _mul(tmp.data(), a + i, bn, b, bn);
+                    else
+                        _mul(tmp.data(), b, bn, a + i, len);
+                    _add(r + i, r + i, an + bn - i, tmp.data(), len + bn);
+                }
+                return;
+            }
+            if (bn < Threshold::s_toom3 || an >= bn * 3 / 2) return _karatsuba(r, a, an, b, bn);
+            _toom3(r, a, an, b, bn);
+        }
+        inline void _div_basecase(limb *q, limb *x, size_type xn, const limb *d, size_type dn) {
+            const limb top = d[dn - 1], second = d[dn - 2];
+            for (size_type j = xn - dn; ~j; j--) {
+                __uint128_t num = __uint128_t(x[j + dn]) << 64 | x[j + dn - 1], qhat = num / top, rhat = num % top;
+                if (qhat >> 64) qhat = limb(-1), rhat = num - qhat * top;
+                while (!(rhat >> 64) && qhat * second > (rhat << 64 | x[j + dn - 2])) qhat--, rhat += top;
+                limb borrow = _submul_1(x + j, d, dn, limb(qhat));
+                if (x[j + dn] < borrow) x[j + dn] -= borrow, qhat--, x[j + dn] += _add_n(x + j, x + j, d, dn);
+                else
+                    x[j + dn] -= borrow;
+                q[j] = limb(qhat);
+            }
+        }
+        inline vec _inv(const limb *d, size_type n) {
+            if (n <= std::max<size_type>(Threshold::s_newton, 4)) {
+                vec x(n * 2 + 1, limb(-1)), q(n + 1);
+                x.back() = 0, _div_basecase(q.data(), x.data(), n * 2, d, n);
+                return q;
+            }
+            size_type h = (n + 1) / 2 + 1;
+            vec vh = _inv(d + n - h, h), dv(d, d + n), base(n * 2 + 1);
+            base.back() = 1;
+            _snum e = _ssub({base, false}, {_vshl(_vmul(dv, vh), uint64_t(n - h) * 64), false});
+            vec corr = _vshr(_vmul(vh, e.m_mag), uint64_t(n + h) * 64), v = _vshl(vh, uint64_t(n - h) * 64);
+            v = e.m_neg ? _vsub(v, corr) : _vadd(v, corr);
+            _snum rem = _ssub(e.m_neg ? _sadd(e, {_vmul(dv, corr), false}) : _ssub(e, {_vmul(dv, corr), false}), {{1}, false});
+            const vec one{1};
+            while (rem.m_neg) v = _vsub(v, one), rem = _sadd(rem, {dv, false});
+            while (_cmp(rem.m_mag, dv) >= 0) v = _vadd(v, one), rem = _ssub(rem, {dv, false});
+            v.resize(n + 1);
+            return v;
+        }
+        struct _Divisor {
+            vec m_d, m_inv;
+            size_type m_shift;
+            _Divisor() = default;
+            _Divisor(const vec &d) : m_shift(std::countl_zero(d.back())) {
+                m_d = _vshl(d, m_shift);
+                if (m_d.size() > Threshold::s_newton) m_inv = _inv(m_d.data(), m_d.size());
+            }
+            void _divmod_block(limb *q, vec &cur) const {
+                size_type n = m_d.size();
+                vec top = _vshr(cur, uint64_t(n - 1) * 64), qv = _vshr(_vmul(top, m_inv), uint64_t(n + 1) * 64);
+                cur = _vsub(cur, _vmul(qv, m_d));
+                const vec one{1};
+                while (_cmp(cur, m_d) >= 0) qv = _vadd(qv, one), cur = _vsub(cur, m_d);
+                std::fill_n(q, n, 0), std::copy(qv.begin(), qv.end(), q);
+            }
+            vec divmod(const vec &x, vec &rem) const {
+                if (_cmp(x, m_d) < 0 && !m_shift) return rem = x, vec{};
+                size_type n = m_d.size();
+                if (n == 1) {
+                    vec q(x.size());
+                    rem.assign(1, _divmod_1(q.data(), x.data(), x.size(), m_d[0] >> m_shift)), _trim(rem), _trim(q);
+                    return q;
+                }
+                vec xs = _vshl(x, m_shift), q;
+                if (xs.size() < n) return rem = x, vec{};
+                if (n <= Threshold::s_newton) {
+                    q.resize(xs.size() - n + 1), xs.push_back(0);
+                    _div_basecase(q.data(), xs.data(), xs.size() - 1, m_d.data(), n), xs.resize(n);
+                } else {
+                    size_type blocks = (xs.size() + n - 1) / n;
+                    xs.resize(blocks * n), q.resize(blocks * n);
+                    vec cur;
+                    for (size_type i = blocks - 1; ~i; i--) {
+                        cur.insert(cur.begin(), xs.begin() + i * n, xs.begin() + (i + 1) * n), _trim(cur);
+                        _divmod_block(q.data() + i * n, cur);
+                    }
+                    xs = cur;
+                }
+                _trim(xs), _trim(q), rem = _vshr(xs, m_shift);
+                return q;
+            }
+        };
+        static constexpr limb dec_chunk = 10000000000000000000ull;
+        static constexpr size_type dec_width = 19;
+        struct _DecimalPowers {
+            std::vector<vec> m_pow;
+            std::vector<_Divisor> m_div;
+            void reserve(size_type level) {
+                if (m_pow.empty()) m_pow.push_back({dec_chunk});
+                while (m_pow.size() <= level) m_pow.push_back(_vmul(m_pow.back(), m_pow.back()));
+            }
+            const _Divisor &divisor(size_type level) {
+                while (m_div.size() <= level) m_div.emplace_back(m_pow[m_div.size()]);
+                return m_div[level];
+            }
+        };
+        inline _DecimalPowers &_powers() {
+            static _DecimalPowers s_powers;
+            return s_powers;
+        }
+        inline void _to_chunks(vec x, std::vector<limb> &chunks, size_type count) {
+            for (size_type i = 0; i != count; i++) chunks.push_back(x.empty() ? 0 : _divmod_1(x.data(), x.data(), x.size(), dec_chunk)), _trim(x);
+        }
+        inline void _to_decimal(const vec &x, size_type level, std::vector<limb> &chunks) {
+            auto &pw = _powers();
+            if (!level || pw.m_pow[level - 1].size() <= Threshold::s_radix) return _to_chunks(x, chunks, size_type(1) << level);
+            vec rem, q = pw.divisor(level - 1).divmod(x, rem);
+            _to_decimal(rem, level - 1, chunks), _to_decimal(q, level - 1, chunks);
+        }
+        inline std::string _to_string(const vec &x) {
+            if (x.empty()) return "0";
+            auto &pw = _powers();
+            size_type level = 0;
+            while (pw.reserve(level), (pw.m_pow[level].size() - 1) * 2 < x.size()) level++;
+            std::vector<limb> chunks;
+            _to_decimal(x, level + 1, chunks);
+            while (chunks.size() > 1 && !chunks.back()) chunks.pop_back();
+            std::string res = std::to_string(chunks.back());
+            res.reserve(res.size() + (chunks.size() - 1) * dec_width);
+            for (size_type i = chunks.size() - 2; ~i; i--) {
+                char buf[dec_width];
+                for (size_type j = dec_width - 1; ~j; j--) buf[j] = '0' + chunks[i] % 10, chunks[i] /= 10;
+                res.append(buf, dec_width);
+            }
+            return res;
+        }
+        inline vec _from_decimal(const char *first, const char *last) {
+            std::vector<vec> parts;
+            for (const char *it = last; it != first;) {
+                const char *from = it - std::min<size_type>(it - first, dec_width);
+                limb chunk = 0;
+                for (const char *p = from; p != it; ++p) chunk = chunk * 10 + (*p - '0');
+                parts.push_back(chunk ? vec{chunk} : vec{}), it = from;
+            }
+            if (parts.empty()) return {};
+            auto &pw = _powers();
+            size_type group = std::bit_floor(std::max<size_type>(Threshold::s_radix, 1)), level = std::countr_zero(group);
+            std::vector<vec> cur;
+            for (size_type i = 0; i < parts.size(); i += group) {
+                vec x;
+                for (size_type j = std::min<size_type>(parts.size(), i + group) - 1; j != i - 1; j--) {
+                    x.push_back(_mul_1(x.data(), x.data(), x.size(), dec_chunk));
+                    if (parts[j].size()) x.push_back(0), x.back() = _add(x.data(), x.data(), x.size() - 1, parts[j].data(), 1);
+                    _trim(x);
+                }
+                cur.push_back(x);
+            }
+            for (; cur.size() > 1; level++) {
+                pw.reserve(level);
+                std::vector<vec> nxt;
+                for (size_type i = 0; i + 1 < cur.size(); i += 2) nxt.push_back(_vadd(_vmul(cur[i + 1], pw.m_pow[level]), cur[i]));
+                if (cur.size() & 1) nxt.push_back(cur.back());
+                cur.swap(nxt);
+            }
+            return cur[0];
+        }
+        struct Int {
+            vec m_data;
+            bool m_neg;
+            Int() : m_neg(false) {}
+            template <typename Tp, typename std::enable_if<std::is_integral<Tp>::value>::type * = nullptr>
+            Int(Tp x) : m_neg(false) {
+                if constexpr (std::is_signed<Tp>::value) m_neg = x < 0;
+                uint64_t y = m_neg ? uint64_t(0) - uint64_t(x) : uint64_t(x);
+                if (y) m_data.push_back(y);
+            }
+            Int(__int128 x) : Int(x < 0 ? __uint128_t(0) - __uint128_t(x) : __uint128_t(x)) { m_neg = x < 0; }
+            Int(__uint128_t x) : m_neg(false) {
+                while (x) m_data.push_back(limb(x)), x >>= 64;
+            }
+            Int(const std::string &str) : Int(str.data(), str.data() + str.size()) {}
+            Int(const char *first, const char *last) : m_neg(first != last && *first == '-') { m_data = _from_decimal(first + (first != last && (*first == '-' || *first == '+')), last), _fix(); }
+            Int(vec data, bool neg) : m_data(std::move(data)), m_neg(neg) { _trim(m_data), _fix(); }
+            void _fix() {
+                if (m_data.empty()) m_neg = false;
+            }
+            size_type size() const { return m_data.size(); }
+            uint64_t bit_width() const { return m_data.empty() ? 0 : uint64_t(m_data.size() - 1) * 64 + std::bit_width(m_data.back()); }
+            bool is_negative() const { return m_neg; }
+            bool is_zero() const { return m_data.empty(); }
+            std::string to_string() const { return m_neg ? "-" + _to_string(m_data) : _to_string(m_data); }
+            explicit operator bool() const { return !m_data.empty(); }
+            template <typename Tp, typename std::enable_if<std::is_integral<Tp>::value>::type * = nullptr>
+            explicit operator Tp() const {
+                __uint128_t x = m_data.empty() ? 0 : m_data[0] | (m_data.size() > 1 ? __uint128_t(m_data[1]) << 64 : 0);
+                return Tp(m_neg ? __uint128_t(0) - x : x);
+            }
+            Int operator-() const { return Int(m_data, !m_neg); }
+            Int abs() const { return Int(m_data, false); }
+            Int &operator+=(const Int &rhs) {
+                _snum res = _sadd({m_data, m_neg}, {rhs.m_data, rhs.m_neg});
+                m_data.swap(res.m_mag), m_neg = res.m_neg, _fix();
+                return *this;
+            }
+            Int &operator-=(const Int &rhs) {
+                _snum res = _ssub({m_data, m_neg}, {rhs.m_data, rhs.m_neg});
+                m_data.swap(res.m_mag), m_neg = res.m_neg, _fix();
+                return *this;
+            }
+            Int &operator*=(const Int &rhs) {
+                m_data = _vmul(m_data, rhs.m_data), m_neg ^= rhs.m_neg, _fix();
+                return *this;
+            }
+            static Int divmod(const Int &a, const Int &b, Int &rem) {
+                vec r, q = _Divisor(b.m_data).divmod(a.m_data, r);
+                rem = Int(std::move(r), a.m_neg);
+                return Int(std::move(q), a.m_neg != b.m_neg);
+            }
+            Int &operator/=(const Int &rhs) {
+                Int rem;
+                return *this = divmod(*this, rhs, rem);
+            }
+            Int &operator%=(const Int &rhs) {
+                divmod(*this, rhs, *this);
+                return *this;
+            }
+            Int &operator<<=(uint64_t k) {
+                m_data = _vshl(m_data, k);
+                return *this;
+            }
+            Int &operator>>=(uint64_t k) {
+                m_data = _vshr(m_data, k), _fix();
+                return *this;
+            }
+            friend Int operator+(Int a, const Int &b) { return a += b; }
+            friend Int operator-(Int a, const Int &b) { return a -= b; }
+            friend Int operator*(const Int &a, const Int &b) { return Int(_vmul(a.m_data, b.m_data), a.m_neg != b.m_neg); }
+            friend Int operator/(const Int &a, const Int &b) {
+                Int rem;
+                return divmod(a, b, rem);
+            }
+            friend Int operator%(const Int &a, const Int &b) {
+                Int rem;
+                return divmod(a, b, rem), rem;
+            }
+            friend Int operator<<(Int a, uint64_t k) { return a <<= k; }
+            friend Int operator>>(Int a, uint64_t k) { return a >>= k; }
+            static int compare(const Int &a, const Int &b) {
+                if (a.m_neg != b.m_neg) return a.m_neg ? -1 : 1;
+                int c = _cmp(a.m_data, b.m_data);
+                return a.m_neg ? -c : c;
+            }
+            friend bool operator==(const Int &a, const Int &b) { return a.m_neg == b.m_neg && a.m_data == b.m_data; }
+            friend bool operator!=(const Int &a, const Int &b) { return !(a == b); }
+            friend bool operator<(const Int &a, const Int &b) { return compare(a, b) < 0; }
+            friend bool operator>(const Int &a, const Int &b) { return compare(a, b) > 0; }
+            friend bool operator<=(const Int &a, const Int &b) { return compare(a, b) <= 0; }
+            friend bool operator>=(const Int &a, const Int &b) { return compare(a, b) >= 0; }
+        };
+        template <typename Istream>
+        Istream &operator>>(Istream &is, Int &x) {
+            std::string s;
+            is >> s, x = Int(s);
+            return is;
+        }
+        template <typename Ostream>
+        Ostream &operator<<(Ostream &os, const Int &x) { return os << x.to_string(); }
+    }
+    using BinaryBigInt = BINBIG::Int;
+}
+
+#endif
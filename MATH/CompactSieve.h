@@ -0,0 +1,153 @@
+/*
+最后修改:
+20261019
+测试环境:
+gcc11.2,c++17
+clang12.0,C++17
+msvc14.2,C++17
+*/
+#ifndef __OY_COMPACTSIEVE__
+#define __OY_COMPACTSIEVE__
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "../TEST/std_bit.h"
+
+namespace OY {
+    namespace CompactSieve {
+        using size_type = uint32_t;
+        using factor_type = uint16_t;
+        struct SievePair {
+            size_type m_prime, m_count;
+            bool operator<(const SievePair &rhs) const { return m_prime < rhs.m_prime; }
+        };
+        static constexpr size_type remainder_30[8] = {1, 7, 11, 13, 17, 19, 23, 29};
+        static constexpr size_type index_30[30] = {8, 0, 8, 8, 8, 8, 8, 1, 8, 8, 8, 2, 8, 3, 8, 8, 8, 4, 8, 5, 8, 8, 8, 6, 8, 8, 8, 8, 8, 7};
+        static constexpr size_type inv_30[30] = {0, 1, 0, 0, 0, 0, 0, 13, 0, 0, 0, 11, 0, 7, 0, 0, 0, 23, 0, 19, 0, 0, 0, 17, 0, 0, 0, 0, 0, 29};
+        template <size_type ThreadNum = 1>
+        struct Sieve {
+            static constexpr size_type segment = 1 << 14;
+            size_type m_range;
+            std::vector<size_type> m_base;
+            std::vector<factor_type> m_factor;
+            template <typename Callback>
+            void _dfs(size_type index, size_type prod, const std::vector<SievePair> &pairs, Callback &&call) const {
+                if (index == pairs.size())
+                    call(prod);
+                else {
+                    auto &&pair = pairs[index];
+                    size_type p = pair.m_prime, c = pair.m_count;
+                    _dfs(index + 1, prod, pairs, call);
+                    while (c--) _dfs(index + 1, prod *= p, pairs, call);
+                }
+            }
+            void _sieve(size_type first, size_type last) {
+                // 每 30 个数为一组，组内只保留与 30 互质的八个数；同一个位置会被多个质数写入，所以质数从大到小处理，最后留下的就是最小质因数
+                std::vector<size_type> pos(m_base.size() * 8);
+                for (size_type k = 0; k != m_base.size(); k++) {
+                    const uint64_t p = m_base[k], q0 = std::max<uint64_t>(p, (uint64_t(first) * 30 + p - 1) / p);
+                    for (size_type i = 0; i != 8; i++) {
+                        const uint64_t qi = remainder_30[i] * inv_30[p % 30] % 30, q = q0 + (qi + 30 - q0 % 30) % 30;
+                        pos[k * 8 + i] = std::min<uint64_t>(p * q / 30, last);
+                    }
+                }
+                for (size_type cur = first; cur < last; cur += segment) {
+                    const size_type end = std::min(last, cur + segment);
+                    for (size_type k = m_base.size() - 1; ~k; k--)
+                        for (size_type p = m_base[k], i = 0; i != 8; i++) {
+                            size_type j = pos[k * 8 + i];
+                            for (; j < end; j += p) m_factor[j * 8 + i] = p;
+                            pos[k * 8 + i] = j;
+                        }
+                }
+            }
+            Sieve(size_type range) : m_range(range), m_factor((size_type(range / 30) + 1) * 8) {
+                size_type sq = std::sqrt(double(range));
+                while (sq * sq > range) sq--;
+                while (uint64_t(sq + 1) * (sq + 1) <= range) sq++;
+                std::vector<bool> vis(sq + 1);
+                for (size_type i = 3; i <= sq; i += 2)
+                    if (!vis[i]) {
+                        if (i >= 7) m_base.push_back(i);
+                        for (size_type j = i * i; j <= sq; j += i << 1) vis[j] = true;
+                    }
+                const size_type tot = range / 30 + 1;
+                if constexpr (ThreadNum == 1)
+                    _sieve(0, tot);
+                else {
+                    std::vector<std::thread> threads;
+                    const size_type block = ((tot + ThreadNum - 1) / ThreadNum + segment - 1) / segment * segment;
+                    for (size_type first = 0; first < tot; first += block) threads.emplace_back([this, first, last = std::min(tot, first + block)] { _sieve(first, last); });
+                    for (auto &t : threads) t.join();
+                }
+            }
+            size_type range() const { return m_range; }
+            bool is_prime(size_type i) const {
+                if (i < 7) return i == 2 || i == 3 || i == 5;
+                const size_type id = index_30[i % 30];
+                return id != 8 && !m_factor[i / 30 * 8 + id];
+            }
+            size_type query_smallest_factor(size_type i) const {
+                if (!(i & 1)) return 2;
+                if (!(i % 3)) return 3;
+                if (!(i % 5)) return 5;
+                const size_type f = m_factor[i / 30 * 8 + index_30[i % 30]];
+                return f ? f : i;
+            }
+            std::vector<SievePair> decomposite(size_type n) const {
+                std::vector<SievePair> res;
+                if (n % 2 == 0) {
+                    size_type x = std::countr_zero(n);
+                    res.push_back({2, x}), n >>= x;
+                }
+                while (n > 1) {
+                    size_type cur = query_smallest_factor(n), cnt = 0;
+                    do {
+                        n /= cur, cnt++;
+                    } while (n % cur == 0);
+                    res.push_back({cur, cnt});
+                }
+                return res;
+            }
+            size_type query_biggest_factor(size_type i) const {
+                if (i == 1) return 1;
+                size_type res = 1;
+                while (i > 1) {
+                    res = query_smallest_factor(i);
+                    do i /= res;
+                    while (i % res == 0);
+                }
+                return res;
+            }
+            size_type get_Euler_Phi(size_type i) const {
+                size_type res = i;
+                while (i > 1) {
+                    const size_type p = query_smallest_factor(i);
+                    res = res / p * (p - 1);
+                    do i /= p;
+                    while (i % p == 0);
+                }
+                return res;
+            }
+            template <typename Callback>
+            void enumerate_factors(const std::vector<SievePair> &pairs, Callback &&call) const { _dfs(0, 1, pairs, call); }
+            template <bool Sorted = false>
+            std::vector<size_type> get_factors(size_type n) const {
+                std::vector<size_type> res;
+                size_type count = 1;
+                auto pairs = decomposite(n);
+                for (auto &&pair : pairs) count *= pair.m_count + 1;
+                res.reserve(count);
+                enumerate_factors(pairs, [&](size_type f) { res.push_back(f); });
+                if constexpr (Sorted) std::sort(res.begin(), res.end());
+                return res;
+            }
+        };
+    }
+}
+
+#endif
@@ -1,6 +1,6 @@
 /*
 最后修改:
-20231127
+20261019
 测试环境:
 gcc11.2,c++11
 clang12.0,C++11
@@ -12,13 +12,143 @@ msvc14.2,C++14
 #include <algorithm>
 #include <cassert>
 #include <cstdint>
+#include <thread>
+#include <type_traits>
 #include <valarray>
+#include <vector>
 
 namespace OY {
-    template <typename Tp>
+    namespace DMAT {
+#ifdef __cpp_lib_void_t
+        template <typename... Tp>
+        using void_t = std::void_t<Tp...>;
+#else
+        template <typename... Tp>
+        struct make_void {
+            using type = void;
+        };
+        template <typename... Tp>
+        using void_t = typename make_void<Tp...>::type;
+#endif
+        template <typename Tp, typename = void>
+        struct Is_modint32 : std::false_type {};
+        template <typename Tp>
+        struct Is_modint32<Tp, void_t<decltype(Tp::mod()), decltype(std::declval<const Tp &>().val()), decltype(Tp::raw(0))>> : std::is_same<typename Tp::mod_type, uint32_t> {};
+        template <uint32_t ThreadNum, typename Callback>
+        void _parallel_do(uint32_t length, uint32_t align, Callback &&call) {
+            if (ThreadNum == 1)
+                call(0, length);
+            else {
+                std::vector<std::thread> threads;
+                uint32_t block = ((length + ThreadNum - 1) / ThreadNum + align - 1) / align * align;
+                for (uint32_t i = 0; i < length; i += block) threads.emplace_back(call, i, std::min(length, i + block));
+                for (auto &t : threads) t.join();
+            }
+        }
+    }
+    template <typename Tp, uint32_t ThreadNum = 1>
     struct DynamicMatrix {
+        static constexpr uint32_t block_row = 32, block_column = 64, block_depth = 256, naive_limit = 1 << 15;
+        static bool s_strassen;
+        static uint32_t s_strassenThreshold;
         uint32_t m_row, m_column;
         std::valarray<Tp> m_val;
+        static void _mul_naive(const DynamicMatrix &a, const DynamicMatrix &b, DynamicMatrix &res) {
+            const uint32_t m = a.row(), n = a.column(), l = b.column();
+            auto work = [&](uint32_t first, uint32_t last) {
+                for (uint32_t i = first; i != last; i++)
+                    for (uint32_t j = 0; j != n; j++) {
+                        Tp x = a[i][j];
+                        for (uint32_t k = 0; k != l; k++) res[i][k] += x * b[j][k];
+                    }
+            };
+            if (uint64_t(m) * n * l > naive_limit)
+                DMAT::_parallel_do<ThreadNum>(m, 1, work);
+            else
+                work(0, m);
+        }
+        static void _mul_mod(const DynamicMatrix &a, const DynamicMatrix &b, DynamicMatrix &res) {
+            // 元素以 uint64_t 累加，每累加 K 次乘积才做一次条件减法，每个结果只取一次模
+            const uint32_t m = a.row(), n = a.column(), l = b.column(), lp = (l + block_column - 1) / block_column * block_column;
+            const uint64_t P = Tp::mod(), Q = (P - 1) * (P - 1), R = (uint64_t(1) << 63) / P * P;
+            // 小模数下 K 可能超出 uint32_t，先在 uint64_t 中截到 block_depth 再收窄
+            const uint32_t K = std::min<uint64_t>(((uint64_t(1) << 63) - P) / Q, block_depth);
+            // a 按行展开，b 按 block_column 列一组打包成连续的竖条
+            std::vector<uint32_t> av(uint64_t(m) * n), bv(uint64_t(n) * lp);
+            for (uint64_t i = 0; i != av.size(); i++) av[i] = a.m_val[i].val();
+            for (uint32_t k = 0; k != n; k++)
+                for (uint32_t j = 0; j != l; j++) bv[(uint64_t(j / block_column) * n + k) * block_column + j % block_column] = b[k][j].val();
+            DMAT::_parallel_do<ThreadNum>(m, block_row, [&](uint32_t first, uint32_t last) {
+                std::vector<uint64_t> buffer(block_row * block_column);
+                for (uint32_t jb = 0; jb != lp; jb += block_column) {
+                    const uint32_t *panel = bv.data() + uint64_t(jb) * n, w = std::min(block_column, l - jb);
+                    for (uint32_t ib = first; ib < last; ib += block_row) {
+                        const uint32_t ie = std::min(last, ib + block_row);
+                        std::fill(buffer.begin(), buffer.end(), 0);
+                        for (uint32_t kb = 0; kb < n; kb += block_depth) {
+                            const uint32_t ke = std::min(n, kb + block_depth);
+                            for (uint32_t i = ib; i != ie; i++) {
+                                uint64_t *acc = buffer.data() + (i - ib) * block_column;
+                                const uint32_t *ai = av.data() + uint64_t(i) * n;
+                                for (uint32_t k = kb; k != ke;) {
+                                    for (uint32_t kk = std::min(ke, k + K); k != kk; k++) {
+                                        const uint32_t x = ai[k], *bk = panel + uint64_t(k) * block_column;
+                                        for (uint32_t j = 0; j != block_column; j++) acc[j] += uint64_t(x) * bk[j];
+                                    }
+                                    for (uint32_t j = 0; j != block_column; j++) acc[j] = acc[j] >= R ? acc[j] - R : acc[j];
+                                }
+                            }
+                        }
+                        for (uint32_t i = ib; i != ie; i++) {
+                            const uint64_t *acc = buffer.data() + (i - ib) * block_column;
+                            Tp *r = res[i] + jb;
+                            for (uint32_t j = 0; j != w; j++) r[j] = Tp::raw(acc[j] % P);
+                        }
+                    }
+                }
+            });
+        }
+        static void _mul(const DynamicMatrix &a, const DynamicMatrix &b, DynamicMatrix &res, std::true_type) {
+            if (Tp::mod() > 1 && Tp::mod() < uint32_t(1) << 31 && uint64_t(a.row()) * a.column() * b.column() > naive_limit) return _mul_mod(a, b, res);
+            _mul_naive(a, b, res);
+        }
+        static void _mul(const DynamicMatrix &a, const DynamicMatrix &b, DynamicMatrix &res, std::false_type) { _mul_naive(a, b, res); }
+        static void _mul(const DynamicMatrix &a, const DynamicMatrix &b, DynamicMatrix &res) { _mul(a, b, res, DMAT::Is_modint32<Tp>()); }
+        static DynamicMatrix _block(const DynamicMatrix &a, uint32_t i0, uint32_t j0, uint32_t m, uint32_t n) {
+            auto res = raw(m, n, 0);
+            for (uint32_t i = i0, iend = std::min(a.row(), i0 + m), w = j0 < a.column() ? std::min(a.column() - j0, n) : 0; i < iend; i++) std::copy_n(a[i] + j0, w, res[i - i0]);
+            return res;
+        }
+        static void _unblock(const DynamicMatrix &a, uint32_t i0, uint32_t j0, DynamicMatrix &res) {
+            for (uint32_t i = i0, iend = std::min(res.row(), i0 + a.row()), w = j0 < res.column() ? std::min(res.column() - j0, a.column()) : 0; i < iend; i++) std::copy_n(a[i - i0], w, res[i] + j0);
+        }
+        static DynamicMatrix _strassen(const DynamicMatrix &a, const DynamicMatrix &b) {
+            const uint32_t m = a.row(), n = a.column(), l = b.column();
+            if (std::min({m, n, l}) <= std::max<uint32_t>(s_strassenThreshold, 1)) {
+                auto res = raw(m, l, 0);
+                _mul(a, b, res);
+                return res;
+            }
+            // Winograd 变体，七次递归乘法，十五次加减法；奇数边长时以零补齐
+            const uint32_t hm = (m + 1) / 2, hn = (n + 1) / 2, hl = (l + 1) / 2;
+            DynamicMatrix a11 = _block(a, 0, 0, hm, hn), a12 = _block(a, 0, hn, hm, hn), a21 = _block(a, hm, 0, hm, hn), a22 = _block(a, hm, hn, hm, hn);
+            DynamicMatrix b11 = _block(b, 0, 0, hn, hl), b12 = _block(b, 0, hl, hn, hl), b21 = _block(b, hn, 0, hn, hl), b22 = _block(b, hn, hl, hn, hl);
+            DynamicMatrix s1 = a21 + a22, s2 = s1 - a11, s3 = a11 - a21, s4 = a12 - s2;
+            DynamicMatrix t1 = b12 - b11, t2 = b22 - t1, t3 = b22 - b12, t4 = t2 - b21;
+            DynamicMatrix p1 = _strassen(a11, b11), u2 = _strassen(s2, t2);
+            u2 += p1;
+            DynamicMatrix u3 = _strassen(s3, t3);
+            u3 += u2;
+            DynamicMatrix p5 = _strassen(s1, t1);
+            u2 += p5;
+            p1 += _strassen(a12, b21);
+            u2 += _strassen(s4, b22);
+            p5 += u3;
+            u3 -= _strassen(a22, t4);
+            auto res = raw(m, l);
+            _unblock(p1, 0, 0, res), _unblock(u2, 0, hl, res), _unblock(u3, hm, 0, res), _unblock(p5, hm, hl, res);
+            return res;
+        }
         DynamicMatrix() = default;
         DynamicMatrix(uint32_t m, uint32_t n, const std::valarray<Tp> &vals) : m_row(m), m_column(n), m_val(vals) {}
         DynamicMatrix(std::initializer_list<std::initializer_list<Tp>> vals) : m_row(vals.size()), m_column(vals.begin()->size()), m_val(m_row * m_column) {
@@ -28,85 +158,68 @@ namespace OY {
                 i += m_column;
             }
         }
-        static DynamicMatrix<Tp> raw(uint32_t m, uint32_t n, Tp val = Tp()) {
-            DynamicMatrix<Tp> res;
+        static DynamicMatrix raw(uint32_t m, uint32_t n, Tp val = Tp()) {
+            DynamicMatrix res;
             res.m_row = m, res.m_column = n, res.m_val.resize(m * n, val);
             return res;
         }
         uint32_t row() const { return m_row; }
         uint32_t column() const { return m_column; }
-        static DynamicMatrix<Tp> unit(uint32_t m) {
+        static DynamicMatrix unit(uint32_t m) {
             auto res = raw(m, m);
             for (uint32_t i = 0; i < m; i++) res[i][i] = 1;
             return res;
         }
         Tp *operator[](uint32_t i) { return &m_val[i * m_column]; }
         const Tp *operator[](uint32_t i) const { return &m_val[i * m_column]; }
-        DynamicMatrix<Tp> &operator+=(Tp a) {
+        DynamicMatrix &operator+=(Tp a) {
             m_val += a;
             return *this;
         }
-        DynamicMatrix<Tp> &operator-=(Tp a) {
+        DynamicMatrix &operator-=(Tp a) {
             m_val -= a;
             return *this;
         }
-        DynamicMatrix<Tp> &operator*=(Tp a) {
+        DynamicMatrix &operator*=(Tp a) {
             m_val *= a;
             return *this;
         }
-        DynamicMatrix<Tp> &operator+=(const DynamicMatrix<Tp> &rhs) {
+        DynamicMatrix &operator+=(const DynamicMatrix &rhs) {
             m_val += rhs.m_val;
             return *this;
         }
-        DynamicMatrix<Tp> &operator-=(const DynamicMatrix<Tp> &rhs) {
+        DynamicMatrix &operator-=(const DynamicMatrix &rhs) {
             m_val -= rhs.m_val;
             return *this;
         }
-        DynamicMatrix<Tp> pow(uint64_t n) const {
+        DynamicMatrix pow(uint64_t n) const {
             assert(row() == column());
-            const uint32_t l = row();
-            DynamicMatrix<Tp> res = unit(l), a = *this, tmp = raw(l, l);
+            DynamicMatrix res = unit(row()), a = *this;
             while (n) {
-                if (n & 1) {
-                    tmp.m_val = 0;
-                    for (uint32_t i = 0; i != l; i++)
-                        for (uint32_t j = 0; j != l; j++) {
-                            Tp x = res[i][j];
-                            for (uint32_t k = 0; k != l; k++) tmp[i][k] += x * a[j][k];
-                        }
-                    res.m_val = tmp.m_val;
-                }
-                if (n >>= 1) {
-                    tmp.m_val = 0;
-                    for (uint32_t i = 0; i != l; i++)
-                        for (uint32_t j = 0; j != l; j++) {
-                            Tp x = a[i][j];
-                            for (uint32_t k = 0; k != l; k++) tmp[i][k] += x * a[j][k];
-                        }
-                    a.m_val = tmp.m_val;
-                }
+                if (n & 1) res = res * a;
+                if (n >>= 1) a = a * a;
             }
             return res;
         }
         template <typename Fp>
-        friend DynamicMatrix<Tp> operator+(const DynamicMatrix<Tp> &a, const Fp &b) { return DynamicMatrix<Tp>(a) += b; }
+        friend DynamicMatrix operator+(const DynamicMatrix &a, const Fp &b) { return DynamicMatrix(a) += b; }
         template <typename Fp>
-        friend DynamicMatrix<Tp> operator-(const DynamicMatrix<Tp> &a, const Fp &b) { return DynamicMatrix<Tp>(a) -= b; }
-        friend DynamicMatrix<Tp> operator*(const DynamicMatrix<Tp> &a, const Tp &b) { return DynamicMatrix<Tp>(a) *= b; }
-        friend DynamicMatrix<Tp> operator*(const DynamicMatrix<Tp> &a, const DynamicMatrix<Tp> &b) {
+        friend DynamicMatrix operator-(const DynamicMatrix &a, const Fp &b) { return DynamicMatrix(a) -= b; }
+        friend DynamicMatrix operator*(const DynamicMatrix &a, const Tp &b) { return DynamicMatrix(a) *= b; }
+        friend DynamicMatrix operator*(const DynamicMatrix &a, const DynamicMatrix &b) {
             assert(a.column() == b.row());
-            const uint32_t m = a.row(), n = a.column(), l = b.column();
-            auto res = raw(m, l, 0);
-            for (uint32_t i = 0; i != m; i++)
-                for (uint32_t j = 0; j != n; j++) {
-                    Tp x = a[i][j];
-                    for (uint32_t k = 0; k != l; k++) res[i][k] += x * b[j][k];
-                }
+            if (s_strassen) return _strassen(a, b);
+            auto res = raw(a.row(), b.column(), 0);
+            _mul(a, b, res);
             return res;
         }
-        friend bool operator==(const DynamicMatrix<Tp> &a, const DynamicMatrix<Tp> &b) { return a.m_val == b.m_val; }
-        friend bool operator!=(const DynamicMatrix<Tp> &a, const DynamicMatrix<Tp> &b) { return a.m_val != b.m_val; }
+        friend bool operator==(const DynamicMatrix &a, const DynamicMatrix &b) { return a.m_row == b.m_row && a.m_column == b.m_column && std::equal(std::begin(a.m_val), std::end(a.m_val), std::begin(b.m_val)); }
+        friend bool operator!=(const DynamicMatrix &a, const DynamicMatrix &b) { return !(a == b); }
     };
+    template <typename Tp, uint32_t ThreadNum>
+    bool DynamicMatrix<Tp, ThreadNum>::s_strassen = false;
+    template <typename Tp, uint32_t ThreadNum>
+    uint32_t DynamicMatrix<Tp, ThreadNum>::s_strassenThreshold = 256;
 };
 
 #endif
\ No newline at end of file
@@ -1,6 +1,6 @@
 /*
 最后修改:
-20231120
+20261019
 测试环境:
 gcc11.2,c++11
 clang12.0,C++11
@@ -13,45 +13,69 @@ msvc14.2,C++14
 #include <cassert>
 #include <cstdint>
 #include <limits>
+#include <type_traits>
+
+#include "DynamicMontgomeryModInt64.h"
 
 #ifdef _MSC_VER
 #include <immintrin.h>
 #endif
 
 namespace OY {
-    template <size_t _Id>
+    template <size_t _Id, bool ThreadLocal = false>
     struct DynamicModInt64 {
-        using mint = DynamicModInt64<_Id>;
+        using mint = DynamicModInt64<_Id, ThreadLocal>;
         using mod_type = uint64_t;
-        mod_type m_val;
-        static mod_type s_mod;
-        static uint64_t s_inv;
-        static bool s_is_prime;
-        static mod_type _mod(uint64_t val) {
+        struct context_type {
+            mod_type m_mod;
+            uint64_t m_inv;
+            bool m_is_prime;
+            context_type() = default;
+            context_type(mod_type P, bool is_prime = false) : m_mod(P), m_inv(-1 / P + 1), m_is_prime(is_prime) { assert(P > 1 && P < mod_type(1) << 63); }
+            mod_type _mod(uint64_t val) const {
 #ifdef _MSC_VER
-            uint64_t res;
-            _umul128(val, s_inv, &res);
-            res = val - res * mod();
+                uint64_t res;
+                _umul128(val, m_inv, &res);
+                res = val - res * m_mod;
 #else
-            mod_type res = val - uint64_t((__uint128_t(val) * s_inv) >> 64) * mod();
+                mod_type res = val - uint64_t((__uint128_t(val) * m_inv) >> 64) * m_mod;
 #endif
-            if (res >= mod()) res += mod();
-            return res;
-        }
-        static mod_type _mul(mod_type a, mod_type b) {
+                if (res >= m_mod) res += m_mod;
+                return res;
+            }
+            mod_type _mul(mod_type a, mod_type b) const {
 #ifdef _MSC_VER
-            mod_type high, low, res;
-            low = _umul128(a, b, &high);
-            _udiv128(high, low, mod(), &res);
+                mod_type high, low, res;
+                low = _umul128(a, b, &high);
+                _udiv128(high, low, m_mod, &res);
 #else
-            int64_t res = a * b - mod_type((long double)(a)*b / mod()) * mod();
-            if (res < 0)
-                res += mod();
-            else if (res >= mod())
-                res -= mod();
+                int64_t res = a * b - mod_type((long double)(a)*b / m_mod) * m_mod;
+                if (res < 0)
+                    res += m_mod;
+                else if (mod_type(res) >= m_mod)
+                    res -= m_mod;
 #endif
-            return res;
+                return res;
+            }
+        };
+        struct context_guard {
+            context_type m_old;
+            context_guard(const context_type &ctx) : m_old(_context()) { _context() = ctx; }
+            ~context_guard() { _context() = m_old; }
+        };
+        static constexpr size_t batch = 16;
+        mod_type m_val;
+        static context_type &_context(std::true_type) {
+            static thread_local context_type s_context;
+            return s_context;
+        }
+        static context_type &_context(std::false_type) {
+            static context_type s_context;
+            return s_context;
         }
+        static context_type &_context() { return _context(std::integral_constant<bool, ThreadLocal>()); }
+        static mod_type _mod(uint64_t val) { return _context()._mod(val); }
+        static mod_type _mul(mod_type a, mod_type b) { return _context()._mul(a, b); }
         DynamicModInt64() : m_val{} {}
         template <typename Tp, typename std::enable_if<std::is_signed<Tp>::value>::type * = nullptr>
         DynamicModInt64(Tp val) : m_val{} {
@@ -66,11 +90,10 @@ namespace OY {
             res.m_val = val;
             return res;
         }
-        static void set_mod(mod_type P, bool is_prime = false) {
-            assert(P > 1 && P < mod_type(1) << 63);
-            s_mod = P, s_inv = -1 / P + 1, s_is_prime = is_prime;
-        }
-        static mod_type mod() { return s_mod; }
+        static void set_mod(mod_type P, bool is_prime = false) { _context() = context_type(P, is_prime); }
+        static context_type get_context() { return _context(); }
+        static void set_context(const context_type &ctx) { _context() = ctx; }
+        static mod_type mod() { return _context().m_mod; }
         mod_type val() const { return m_val; }
         mint pow(uint64_t n) const {
             mod_type res = 1, b = m_val;
@@ -80,7 +103,7 @@ namespace OY {
             }
             return raw(res);
         }
-        mint inv() const { return s_is_prime ? inv_Fermat() : inv_exgcd(); }
+        mint inv() const { return _context().m_is_prime ? inv_Fermat() : inv_exgcd(); }
         mint inv_exgcd() const {
             mod_type x = mod(), y = m_val, m0 = 0, m1 = 1;
             while (y) {
@@ -139,17 +162,41 @@ namespace OY {
         friend mint operator-(const mint &a, const mint &b) { return mint(a) -= b; }
         friend mint operator*(const mint &a, const mint &b) { return mint(a) *= b; }
         friend mint operator/(const mint &a, const mint &b) { return mint(a) /= b; }
+        static void mul_batch(const mint *a, const mint *b, mint *res, size_t n) {
+            const context_type ctx = _context();
+            for (size_t i = 0; i != n; i++) res[i].m_val = ctx._mul(a[i].m_val, b[i].m_val);
+        }
+        template <typename Init, typename Mul, typename Reduce>
+        static void _pow_batch(const mint *a, uint64_t n, mint *res, size_t len, Init &&init, Mul &&mul, Reduce &&reduce) {
+            // 每 batch 个数一组同步地做快速幂，组内各数的乘法互不依赖，可以填满乘法器的流水线
+            const mod_type one = init(1);
+            for (size_t i = 0; i < len; i += batch) {
+                const size_t m = std::min(batch, len - i);
+                mod_type r[batch], b[batch];
+                for (size_t j = 0; j != batch; j++) r[j] = one, b[j] = j < m ? init(a[i + j].m_val) : 0;
+                for (uint64_t k = n; k; k >>= 1) {
+                    if (k & 1)
+                        for (size_t j = 0; j != batch; j++) r[j] = mul(r[j], b[j]);
+                    if (k > 1)
+                        for (size_t j = 0; j != batch; j++) b[j] = mul(b[j], b[j]);
+                }
+                for (size_t j = 0; j != m; j++) res[i + j].m_val = reduce(r[j]);
+            }
+        }
+        static void pow_batch(const mint *a, uint64_t n, mint *res, size_t len) {
+            // long double 除法无法流水，所以模数为奇数时改用蒙哥马利约减
+            const context_type ctx = _context();
+            if (ctx.m_mod % 2) {
+                const typename DynamicMontgomeryModInt64<_Id>::context_type mg(ctx.m_mod);
+                _pow_batch(a, n, res, len, [&](mod_type x) { return mg._raw_init(x); }, [&](mod_type x, mod_type y) { return mg._mul(x, y); }, [&](mod_type x) { return mg._reduce(x); });
+            } else
+                _pow_batch(a, n, res, len, [](mod_type x) { return x; }, [&](mod_type x, mod_type y) { return ctx._mul(x, y); }, [](mod_type x) { return x; });
+        }
     };
-    template <size_t Id>
-    uint64_t DynamicModInt64<Id>::s_mod;
-    template <size_t Id>
-    uint64_t DynamicModInt64<Id>::s_inv;
-    template <size_t Id>
-    bool DynamicModInt64<Id>::s_is_prime;
-    template <typename Istream, size_t Id>
-    Istream &operator>>(Istream &is, DynamicModInt64<Id> &x) { return is >> x.m_val; }
-    template <typename Ostream, size_t Id>
-    Ostream &operator<<(Ostream &os, const DynamicModInt64<Id> &x) { return os << x.m_val; }
+    template <typename Istream, size_t Id, bool ThreadLocal>
+    Istream &operator>>(Istream &is, DynamicModInt64<Id, ThreadLocal> &x) { return is >> x.m_val; }
+    template <typename Ostream, size_t Id, bool ThreadLocal>
+    Ostream &operator<<(Ostream &os, const DynamicModInt64<Id, ThreadLocal> &x) { return os << x.m_val; }
 }
 
 #endif
\ No newline at end of file
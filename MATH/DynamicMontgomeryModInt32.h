@@ -1,6 +1,6 @@
 /*
 最后修改:
-20231120
+20261019
 测试环境:
 gcc11.2,c++11
 clang12.0,C++11
@@ -13,42 +13,70 @@ msvc14.2,C++14
 #include <cassert>
 #include <cstdint>
 #include <limits>
+#include <type_traits>
 
 namespace OY {
-    template <size_t Id>
+    template <size_t Id, bool ThreadLocal = false>
     struct DynamicMontgomeryModInt32 {
-        using mint = DynamicMontgomeryModInt32<Id>;
+        using mint = DynamicMontgomeryModInt32<Id, ThreadLocal>;
         using mod_type = uint32_t;
         using fast_type = mod_type;
         using long_type = uint64_t;
-        static mod_type s_mod, s_pinv, s_ninv;
-        static uint64_t s_inv;
-        static bool s_is_prime;
-        fast_type m_val;
-        static mod_type _mod(uint64_t val) {
+        struct context_type {
+            mod_type m_mod, m_pinv, m_ninv;
+            uint64_t m_inv;
+            bool m_is_prime;
+            context_type() = default;
+            context_type(mod_type P, bool is_prime = false) : m_mod(P), m_pinv(P), m_ninv(-long_type(P) % P), m_inv(uint64_t(-1) / P + 1), m_is_prime(is_prime) {
+                assert(P % 2 && P > 1 && P < mod_type(1) << 31);
+                for (size_t i = 0; i != 4; i++) m_pinv *= mod_type(2) - m_mod * m_pinv;
+            }
+            mod_type _mod(uint64_t val) const {
 #ifdef _MSC_VER
-            uint64_t x;
-            _umul128(val, s_inv, &x);
-            mod_type res = val - x * mod();
+                uint64_t x;
+                _umul128(val, m_inv, &x);
+                mod_type res = val - x * m_mod;
 #else
-            mod_type res = val - uint64_t((__uint128_t(val) * s_inv) >> 64) * mod();
+                mod_type res = val - uint64_t((__uint128_t(val) * m_inv) >> 64) * m_mod;
 #endif
-            if (res >= mod()) res += mod();
-            return res;
-        }
-        static fast_type _init(uint64_t val) { return _raw_init(_mod(val)); }
-        static fast_type _raw_init(mod_type val) { return _mul(val, s_ninv); }
-        static mod_type _reduce(fast_type val) {
-            mod_type res = -mod_type((long_type(val * s_pinv) * mod()) >> 32);
-            if (res >= mod()) res += mod();
-            return res;
+                if (res >= m_mod) res += m_mod;
+                return res;
+            }
+            fast_type _raw_init(mod_type val) const { return _mul(val, m_ninv); }
+            mod_type _reduce(fast_type val) const {
+                mod_type res = -mod_type((long_type(val * m_pinv) * m_mod) >> 32);
+                if (res >= m_mod) res += m_mod;
+                return res;
+            }
+            fast_type _reduce_long(long_type val) const {
+                fast_type res = (val >> 32) - mod_type((long_type(mod_type(val) * m_pinv) * m_mod) >> 32);
+                if (res >= m_mod) res += m_mod;
+                return res;
+            }
+            fast_type _mul(fast_type a, fast_type b) const { return _reduce_long(long_type(a) * b); }
+        };
+        struct context_guard {
+            context_type m_old;
+            context_guard(const context_type &ctx) : m_old(_context()) { _context() = ctx; }
+            ~context_guard() { _context() = m_old; }
+        };
+        static constexpr size_t batch = 64;
+        fast_type m_val;
+        static context_type &_context(std::true_type) {
+            static thread_local context_type s_context;
+            return s_context;
         }
-        static fast_type _reduce_long(long_type val) {
-            fast_type res = (val >> 32) - mod_type((long_type(mod_type(val) * s_pinv) * mod()) >> 32);
-            if (res >= mod()) res += mod();
-            return res;
+        static context_type &_context(std::false_type) {
+            static context_type s_context;
+            return s_context;
         }
-        static fast_type _mul(fast_type a, fast_type b) { return _reduce_long(long_type(a) * b); }
+        static context_type &_context() { return _context(std::integral_constant<bool, ThreadLocal>()); }
+        static mod_type _mod(uint64_t val) { return _context()._mod(val); }
+        static fast_type _init(uint64_t val) { return _raw_init(_mod(val)); }
+        static fast_type _raw_init(mod_type val) { return _context()._raw_init(val); }
+        static mod_type _reduce(fast_type val) { return _context()._reduce(val); }
+        static fast_type _reduce_long(long_type val) { return _context()._reduce_long(val); }
+        static fast_type _mul(fast_type a, fast_type b) { return _context()._mul(a, b); }
         DynamicMontgomeryModInt32() : m_val{} {}
         template <typename Tp, typename std::enable_if<std::is_signed<Tp>::value>::type * = nullptr>
         DynamicMontgomeryModInt32(Tp val) : m_val{} {
@@ -64,12 +92,10 @@ namespace OY {
             return res;
         }
         static mint raw(mod_type val) { return _raw(_raw_init(val)); }
-        static void set_mod(mod_type P, bool is_prime = false) {
-            assert(P % 2 && P > 1 && P < mod_type(1) << 31);
-            s_mod = s_pinv = P, s_ninv = -long_type(P) % P, s_inv = uint64_t(-1) / P + 1, s_is_prime = is_prime;
-            for (size_t i = 0; i != 4; i++) s_pinv *= mod_type(2) - mod() * s_pinv;
-        }
-        static mod_type mod() { return s_mod; }
+        static void set_mod(mod_type P, bool is_prime = false) { _context() = context_type(P, is_prime); }
+        static context_type get_context() { return _context(); }
+        static void set_context(const context_type &ctx) { _context() = ctx; }
+        static mod_type mod() { return _context().m_mod; }
         mod_type val() const { return _reduce(m_val); }
         mint pow(uint64_t n) const {
             fast_type res = _raw_init(1), b = m_val;
@@ -79,7 +105,7 @@ namespace OY {
             }
             return _raw(res);
         }
-        mint inv() const { return s_is_prime ? inv_Fermat() : inv_exgcd(); }
+        mint inv() const { return _context().m_is_prime ? inv_Fermat() : inv_exgcd(); }
         mint inv_exgcd() const {
             mod_type x = mod(), y = val(), m0 = 0, m1 = 1;
             while (y) {
@@ -137,26 +163,37 @@ namespace OY {
         friend mint operator-(const mint &a, const mint &b) { return mint(a) -= b; }
         friend mint operator*(const mint &a, const mint &b) { return mint(a) *= b; }
         friend mint operator/(const mint &a, const mint &b) { return mint(a) /= b; }
+        static void mul_batch(const mint *a, const mint *b, mint *res, size_t n) {
+            const context_type ctx = _context();
+            for (size_t i = 0; i != n; i++) res[i].m_val = ctx._mul(a[i].m_val, b[i].m_val);
+        }
+        static void pow_batch(const mint *a, uint64_t n, mint *res, size_t len) {
+            // 每 batch 个数一组同步地做快速幂，组内各数的乘法互不依赖，可以填满乘法器的流水线，也便于编译器向量化
+            const context_type ctx = _context();
+            const fast_type one = ctx._raw_init(1);
+            for (size_t i = 0; i < len; i += batch) {
+                const size_t m = std::min(batch, len - i);
+                fast_type r[batch], b[batch];
+                for (size_t j = 0; j != batch; j++) r[j] = one, b[j] = j < m ? a[i + j].m_val : 0;
+                for (uint64_t k = n; k; k >>= 1) {
+                    if (k & 1)
+                        for (size_t j = 0; j != batch; j++) r[j] = ctx._mul(r[j], b[j]);
+                    if (k > 1)
+                        for (size_t j = 0; j != batch; j++) b[j] = ctx._mul(b[j], b[j]);
+                }
+                for (size_t j = 0; j != m; j++) res[i + j].m_val = r[j];
+            }
+        }
     };
-    template <size_t Id>
-    uint32_t DynamicMontgomeryModInt32<Id>::s_mod;
-    template <size_t Id>
-    uint32_t DynamicMontgomeryModInt32<Id>::s_pinv;
-    template <size_t Id>
-    uint32_t DynamicMontgomeryModInt32<Id>::s_ninv;
-    template <size_t Id>
-    uint64_t DynamicMontgomeryModInt32<Id>::s_inv;
-    template <size_t Id>
-    bool DynamicMontgomeryModInt32<Id>::s_is_prime;
-    template <typename Istream, size_t Id>
-    Istream &operator>>(Istream &is, DynamicMontgomeryModInt32<Id> &x) {
+    template <typename Istream, size_t Id, bool ThreadLocal>
+    Istream &operator>>(Istream &is, DynamicMontgomeryModInt32<Id, ThreadLocal> &x) {
         uint32_t val;
         is >> val;
-        x.m_val = DynamicMontgomeryModInt32<Id>::_raw_init(val);
+        x.m_val = DynamicMontgomeryModInt32<Id, ThreadLocal>::_raw_init(val);
         return is;
     }
-    template <typename Ostream, size_t Id>
-    Ostream &operator<<(Ostream &os, const DynamicMontgomeryModInt32<Id> &x) { return os << x.val(); }
+    template <typename Ostream, size_t Id, bool ThreadLocal>
+    Ostream &operator<<(Ostream &os, const DynamicMontgomeryModInt32<Id, ThreadLocal> &x) { return os << x.val(); }
 }
 
 #endif
\ No newline at end of file
@@ -69,11 +69,41 @@ namespace OY {
         }
         template <typename _Iterator, typename _Iterator2, typename _Operation = std::multiplies<complex>>
         static _Iterator _transform(_Iterator __iter1, _Iterator2 __iter2, uint32_t __length, _Operation __op = _Operation()) { return std::transform(__iter1, __iter1 + __length, __iter2, __iter1, __op) - __length; }
+        template <typename _Iterator>
+        static complex *_fold(complex *__iter, uint32_t __length, _Iterator __source, uint32_t __sourceLength) {
+            std::fill(std::copy_n(__source, std::min(__length, __sourceLength), __iter), __iter + __length, _Fp(0));
+            for (uint32_t i = __length; i < __sourceLength; i++) __iter[i & (__length - 1)] += complex(*(__source + i));
+            return __iter;
+        }
+        template <typename _Iterator>
+        static complex *_cyclic(_Iterator __a, uint32_t __aLength, _Iterator __b, uint32_t __bLength, uint32_t __length) { return idft(_transform(dft(_fold(s_dftBuffer, __length, __a, __aLength), __length), dft(_fold(s_dftBuffer + __length, __length, __b, __bLength), __length), __length, std::multiplies<complex>()), __length); }
         static poly product(const poly &__a, const poly &__b, uint32_t __length) {
             if (__a.empty() || __b.empty()) return poly();
-            idft(_transform(dft(s_dftBuffer, __length, __a.begin(), std::min<uint32_t>(__length, __a.size())), dft(s_dftBuffer + __length, __length, __b.begin(), std::min<uint32_t>(__length, __b.size())), __length, std::multiplies<complex>()), __length);
+            _cyclic(__a.begin(), std::min<uint32_t>(__length, __a.size()), __b.begin(), std::min<uint32_t>(__length, __b.size()), __length);
             return poly(s_dftBuffer, s_dftBuffer + __length);
         }
+        static poly productFirst(const poly &__a, const poly &__b, uint32_t __n) {
+            const uint32_t a = std::min<uint32_t>(__a.size(), __n), b = std::min<uint32_t>(__b.size(), __n);
+            if (!a || !b) return poly();
+            const uint32_t total = a + b - 1, n = std::min(__n, total), length = std::__bit_floor(total), high = total - length;
+            if (!high || high > length / 2) {
+                const uint32_t len = std::__bit_ceil(total);
+                return poly(_cyclic(__a.begin(), a, __b.begin(), b, len), s_dftBuffer + n);
+            }
+            // 乘积的第 length 项及以上会绕回到低位；把乘积最高的 high 项单独算出来，从低位减去
+            poly ra(__a.begin() + (a - std::min(a, high)), __a.begin() + a), rb(__b.begin() + (b - std::min(b, high)), __b.begin() + b), res(n);
+            poly top(productFirst(ra.reverse(), rb.reverse(), high));
+            _cyclic(__a.begin(), a, __b.begin(), b, length);
+            for (uint32_t i = 0; i < std::min(n, length); i++) res[i] = s_dftBuffer[i];
+            for (uint32_t i = 0; i < high; i++) res[i] -= top.at(high - 1 - i);
+            for (uint32_t i = length; i < n; i++) res[i] = top.at(total - 1 - i);
+            return res;
+        }
+        static poly productMiddle(const poly &__a, const poly &__b) {
+            if (__b.empty() || __a.size() < __b.size()) return poly();
+            _cyclic(__a.begin(), __a.size(), __b.begin(), __b.size(), std::__bit_ceil(__a.size()));
+            return poly(s_dftBuffer + (__b.size() - 1), s_dftBuffer + __a.size());
+        }
         poly &shrink() {
             while (size() && !back()) pop_back();
             return *this;
@@ -102,7 +132,7 @@ namespace OY {
                 for (auto &a : *this) a *= __other;
             return *this;
         }
-        poly &operator*=(const poly &__other) { return (*this = product(*this, __other, std::__bit_ceil(size() + __other.size() - 1))).shrink(); }
+        poly &operator*=(const poly &__other) { return (*this = productFirst(*this, __other, size() + __other.size() - 1)).shrink(); }
         poly &operator/=(_Tp __other) {
             for (auto &a : *this) a /= __other;
             return *this;
@@ -129,7 +159,7 @@ namespace OY {
             return res;
         }
         friend poly operator*(const poly &__a, const poly &__b) {
-            poly res(product(__a, __b, std::__bit_ceil(__a.size() + __b.size() - 1)));
+            poly res(productFirst(__a, __b, __a.size() + __b.size() - 1));
             res.shrink();
             return res;
         }
@@ -1,6 +1,6 @@
 /*
 最后修改:
-20231129
+20261019
 测试环境:
 gcc11.2,c++11
 clang12.0,C++11
@@ -11,8 +11,10 @@ msvc14.2,C++14
 
 #include <algorithm>
 #include <bitset>
+#include <cmath>
 #include <cstdint>
 #include <numeric>
+#include <thread>
 #include <vector>
 
 #include "../TEST/std_bit.h"
@@ -127,6 +129,124 @@ namespace OY {
         mask_type FastSieve<MAX_RANGE>::s_buffer[block_size];
         template <size_type MAX_RANGE>
         SieveNode FastSieve<MAX_RANGE>::s_nodes[FastSieve<MAX_RANGE>::max_r];
+        template <size_type ThreadNum = 1>
+        struct SegmentedSieve {
+            static constexpr size_type min_segment = 1 << 15, max_segment = 1 << 20;
+            static inline mask_type s_masks[block_size];
+            std::vector<size_type> m_base;
+            size_type m_sqrt = 0, m_segment = min_segment;
+            static size_type _isqrt(uint64_t x) {
+                uint64_t r = sqrtl(x);
+                while (r * r > x) r--;
+                while ((r + 1) * (r + 1) <= x) r++;
+                return r;
+            }
+            void _prepare(uint64_t right) {
+                if (!s_masks[0]) {
+                    std::fill_n(s_masks, block_size, -1);
+                    for (size_type p : {7, 11, 13, 17})
+                        for (size_type i = 0; i != 8; i++) {
+                            size_type j = p;
+                            while (j % 30 != remainder_30[i]) j += p << 1;
+                            for (j /= 30; j < block_size; j += p) s_masks[j] &= ~(1 << i);
+                        }
+                }
+                const size_type sq = _isqrt(right);
+                // 段长取 L1 大小与 sqrt(right) 中的较大者，使每段中每个基质数的固定开销能被摊薄
+                m_segment = std::min<size_type>(max_segment, std::max<size_type>(min_segment, std::bit_ceil(sq)));
+                if (sq <= m_sqrt) return;
+                std::vector<bool> vis(sq + 1);
+                m_base.clear();
+                for (size_type i = 3; i <= sq; i += 2)
+                    if (!vis[i]) {
+                        if (i >= 19) m_base.push_back(i);
+                        for (uint64_t j = uint64_t(i) * i; j <= sq; j += i << 1) vis[j] = true;
+                    }
+                m_sqrt = sq;
+            }
+            template <typename Callback>
+            void _sieve(uint64_t first, uint64_t last, Callback &&call) const {
+                // 以 30 为轮，每个字节表示 30 个数中与 30 互质的 8 个数；按 m_segment 字节分段，每段先铺上 7,11,13,17 的筛除模式
+                static constexpr size_type inv_30[30] = {0, 1, 0, 0, 0, 0, 0, 13, 0, 0, 0, 11, 0, 7, 0, 0, 0, 23, 0, 19, 0, 0, 0, 17, 0, 0, 0, 0, 0, 29};
+                std::vector<uint64_t> pos(m_base.size() * 8);
+                for (size_type k = 0; k != m_base.size(); k++) {
+                    const uint64_t p = m_base[k], q0 = std::max(p, (first * 30 + p - 1) / p);
+                    for (size_type i = 0; i != 8; i++) {
+                        const uint64_t qi = remainder_30[i] * inv_30[p % 30] % 30, q = q0 + (qi + 30 - q0 % 30) % 30;
+                        pos[k * 8 + i] = p * q / 30;
+                    }
+                }
+                std::vector<mask_type> buffer(m_segment);
+                mask_type *buf = buffer.data();
+                for (uint64_t cur = first; cur < last; cur += m_segment) {
+                    const size_type len = std::min<uint64_t>(m_segment, last - cur);
+                    for (size_type i = 0, offset = cur % block_size; i < len;) {
+                        const size_type step = std::min(len - i, block_size - offset);
+                        std::copy_n(s_masks + offset, step, buf + i);
+                        i += step, offset = 0;
+                    }
+                    if (!cur) buf[0] &= 0xfe;
+                    const uint64_t end = cur + len;
+                    for (size_type k = 0; k != m_base.size() && uint64_t(m_base[k]) * m_base[k] < end * 30; k++)
+                        for (size_type p = m_base[k], i = 0; i != 8; i++) {
+                            uint64_t j = pos[k * 8 + i];
+                            for (; j < end; j += p) buf[j - cur] &= ~(1 << i);
+                            pos[k * 8 + i] = j;
+                        }
+                    call(buf, cur, len);
+                }
+            }
+            template <typename Callback>
+            void _parallel_sieve(uint64_t first, uint64_t last, Callback &&call) const {
+                if constexpr (ThreadNum == 1)
+                    _sieve(first, last, [&](const mask_type *buf, uint64_t cur, size_type len) { call(0, buf, cur, len); });
+                else {
+                    std::vector<std::thread> threads;
+                    const uint64_t block = ((last - first + ThreadNum - 1) / ThreadNum + m_segment - 1) / m_segment * m_segment;
+                    for (size_type t = 0; t != ThreadNum && first + block * t < last; t++)
+                        threads.emplace_back([&, t] { _sieve(first + block * t, std::min(last, first + block * (t + 1)), [&](const mask_type *buf, uint64_t cur, size_type len) { call(t, buf, cur, len); }); });
+                    for (auto &t : threads) t.join();
+                }
+            }
+            template <typename Callback>
+            void enumerate(uint64_t left, uint64_t right, Callback &&call) {
+                if (left >= right) return;
+                for (size_type p : {2, 3, 5, 7, 11, 13, 17})
+                    if (left <= p && p < right) call(uint64_t(p));
+                _prepare(right - 1);
+                _parallel_sieve(left / 30, (right + 29) / 30, [&](size_type, const mask_type *buf, uint64_t cur, size_type len) {
+                    for (size_type i = 0; i != len; i++)
+                        for (mask_type mask = buf[i]; mask;) {
+                            size_type x = std::countr_zero(mask);
+                            const uint64_t val = (cur + i) * 30 + remainder_30[x];
+                            if (val >= left && val < right) call(val);
+                            mask -= size_type(1) << x;
+                        }
+                });
+            }
+            uint64_t count(uint64_t left, uint64_t right) {
+                if (left >= right) return 0;
+                uint64_t res = 0, cnt[ThreadNum]{};
+                for (size_type p : {2, 3, 5, 7, 11, 13, 17})
+                    if (left <= p && p < right) res++;
+                _prepare(right - 1);
+                const uint64_t first = left / 30, last = (right + 29) / 30;
+                auto valid = [&](uint64_t b) {
+                    mask_type mask = 0;
+                    for (size_type i = 0; i != 8; i++)
+                        if (b * 30 + remainder_30[i] >= left && b * 30 + remainder_30[i] < right) mask |= 1 << i;
+                    return mask;
+                };
+                _parallel_sieve(first, last, [&](size_type t, const mask_type *buf, uint64_t cur, size_type len) {
+                    uint64_t c = 0;
+                    for (size_type i = 0; i != len; i++) c += std::popcount(buf[i]);
+                    if (cur == first) c -= std::popcount(mask_type(buf[0] & ~valid(first)));
+                    if (cur + len == last && last - 1 != first) c -= std::popcount(mask_type(buf[len - 1] & ~valid(last - 1)));
+                    cnt[t] += c;
+                });
+                return std::accumulate(cnt, cnt + ThreadNum, res);
+            }
+        };
     }
 }
 
@@ -0,0 +1,98 @@
+#ifndef __OY_LINEARRECURRENCE__
+#define __OY_LINEARRECURRENCE__
+
+#include <numeric>
+#include <vector>
+
+#include "NTTPolynomial.h"
+
+namespace OY {
+    template <typename _Poly>
+    struct LinearRecurrence {
+        using poly = _Poly;
+        using value_type = typename _Poly::value_type;
+        using transformed = typename _Poly::TransformedPolynomial;
+        uint32_t m_order, m_length;
+        poly m_init, m_weight, m_numer;
+        std::vector<poly> m_denom;
+        std::vector<transformed> m_flip;
+        static poly BerlekampMassey(const poly &__seq) {
+            poly cur, last;
+            uint32_t lastPos = 0;
+            value_type lastDelta = 0;
+            for (uint32_t i = 0; i != __seq.size(); i++) {
+                value_type delta = __seq[i];
+                for (uint32_t j = 0; j != cur.size(); j++) delta -= cur[j] * __seq[i - 1 - j];
+                if (delta == value_type(0)) continue;
+                if (lastDelta == value_type(0)) {
+                    cur.assign(i + 1, value_type(0)), lastPos = i, lastDelta = delta;
+                    continue;
+                }
+                poly prev(cur);
+                const value_type k = delta / lastDelta;
+                if (cur.size() < last.size() + i - lastPos) cur.resize(last.size() + i - lastPos);
+                cur[i - lastPos - 1] += k;
+                for (uint32_t j = 0; j != last.size(); j++) cur[i - lastPos + j] -= k * last[j];
+                if (prev.size() + lastPos < last.size() + i) last = prev, lastPos = i, lastDelta = delta;
+            }
+            return cur;
+        }
+        static LinearRecurrence fromSequence(const poly &__seq) {
+            poly weight(BerlekampMassey(__seq));
+            return LinearRecurrence(poly(__seq.begin(), __seq.begin() + weight.size()), weight);
+        }
+        LinearRecurrence(const poly &__init, const poly &__weight) : m_order(__weight.size()), m_length(std::__bit_ceil(std::max<uint32_t>(__weight.size() * 2, 1))), m_init(__init), m_weight(__weight) {
+            m_init.resize(m_order);
+            poly denom(m_order + 1);
+            denom[0] = 1;
+            for (uint32_t i = 0; i != m_order; i++) denom[i + 1] = -m_weight[i];
+            m_numer = (m_init * denom).sizeTo(m_order);
+            m_denom.push_back(denom);
+        }
+        uint32_t order() const { return m_order; }
+        const poly &init() const { return m_init; }
+        const poly &weight() const { return m_weight; }
+        void _prepare(uint32_t __level) {
+            // 第 j 层的分母只与层数有关，与所求的项无关，所以可以在多次查询之间共用
+            while (m_flip.size() <= __level) {
+                poly flip(m_denom.back());
+                for (uint32_t i = 1; i < flip.size(); i += 2) flip[i] = -flip[i];
+                poly square((m_denom.back() * flip).sizeTo(m_order * 2 + 1)), denom(m_order + 1);
+                for (uint32_t i = 0; i <= m_order; i++) denom[i] = square[i * 2];
+                m_flip.emplace_back(flip, m_length);
+                m_denom.push_back(denom);
+            }
+        }
+        poly _half(const poly &__f, uint32_t __level, uint32_t __parity) {
+            poly u(poly::product(__f, m_flip[__level])), res(m_order);
+            for (uint32_t i = 0; i != m_order; i++) res[i] = u[i * 2 + __parity];
+            return res;
+        }
+        void _query(const uint64_t *__ns, uint32_t *__first, uint32_t *__last, uint32_t __level, const poly &__f, value_type *__res) {
+            uint32_t *mid = std::partition(__first, __last, [&](uint32_t i) { return __level == 64 || !(__ns[i] >> __level); });
+            for (uint32_t *it = __first; it != mid; ++it) __res[*it] = __f[0];
+            if (mid == __last) return;
+            _prepare(__level);
+            uint32_t *mid2 = std::partition(mid, __last, [&](uint32_t i) { return !(__ns[i] >> __level & 1); });
+            if (mid != mid2) _query(__ns, mid, mid2, __level + 1, _half(__f, __level, 0), __res);
+            if (mid2 != __last) _query(__ns, mid2, __last, __level + 1, _half(__f, __level, 1), __res);
+        }
+        value_type query(uint64_t __n) {
+            if (__n < m_order) return m_init[__n];
+            if (!m_order) return value_type(0);
+            poly f(m_numer);
+            for (uint32_t level = 0; __n; level++, __n >>= 1) _prepare(level), f = _half(f, level, __n & 1);
+            return f[0];
+        }
+        std::vector<value_type> query(const std::vector<uint64_t> &__ns) {
+            std::vector<value_type> res(__ns.size());
+            if (!m_order) return res;
+            std::vector<uint32_t> ids(__ns.size());
+            std::iota(ids.begin(), ids.end(), 0);
+            _query(__ns.data(), ids.data(), ids.data() + ids.size(), 0, m_numer, res.data());
+            return res;
+        }
+    };
+}
+
+#endif
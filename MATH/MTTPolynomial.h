@@ -25,7 +25,7 @@ namespace OY {
             complex &operator+=(const complex &_other) { return *this = complex(x + _other.x, y + _other.y); }
             complex &operator-=(const complex &_other) { return *this = complex(x - _other.x, y - _other.y); }
             complex &operator*=(const complex &_other) { return *this = complex(x * _other.x - y * _other.y, x * _other.y + y * _other.x); }
-            operator _Tp() const { return std::round(x) * _Tp(_Split) + std::round(y); }
+            operator _Tp() const { return _Tp(int64_t(std::round(x))) * _Tp(_Split) + _Tp(int64_t(std::round(y))); }
         } s_dftRoots[_MAXN], s_dftBuffer[_MAXN * 2], s_treeBuffer[_MAXN * 2 * (std::__countr_zero(_MAXN))];
         static inline struct complex_pair {
             complex p, q;
@@ -42,7 +42,7 @@ namespace OY {
             operator _Tp() const {
                 complex x(p + q), y(p - q);
                 _Tp u(_Split);
-                return _Tp(std::round(x.x / 2) * u + std::round((x.y + y.y) / 2)) * u + std::round(-y.x / 2);
+                return (_Tp(int64_t(std::round(x.x / 2))) * u + _Tp(int64_t(std::round((x.y + y.y) / 2)))) * u + _Tp(int64_t(std::round(-y.x / 2)));
             }
             operator complex() const { return _Tp(*this); }
         } s_dftResultBuffer[_MAXN];
@@ -122,11 +122,41 @@ namespace OY {
             for (uint32_t i = __length; i; i--) *(__iter + i) = *(__iter + (i - 1)) * s_inverse[i];
             __iter[0] = 0;
         }
+        template <typename _Iterator>
+        static complex *_fold(complex *__iter, uint32_t __length, _Iterator __source, uint32_t __sourceLength) {
+            std::fill(std::copy_n(__source, std::min(__length, __sourceLength), __iter), __iter + __length, _Fp(0));
+            for (uint32_t i = __length; i < __sourceLength; i++) __iter[i & (__length - 1)] += complex(*(__source + i));
+            return __iter;
+        }
+        template <typename _Iterator>
+        static complex_pair *_cyclic(_Iterator __a, uint32_t __aLength, _Iterator __b, uint32_t __bLength, uint32_t __length) { return idft(_transform(s_dftResultBuffer, dft(_fold(s_dftBuffer, __length, __a, __aLength), __length), dft(_fold(s_dftBuffer + __length, __length, __b, __bLength), __length), __length), __length); }
         static poly product(const poly &__a, const poly &__b, uint32_t __length) {
             if (__a.empty() || __b.empty()) return poly();
-            idft(_transform(s_dftResultBuffer, dft(s_dftBuffer, __length, __a.begin(), std::min<uint32_t>(__length, __a.size())), dft(s_dftBuffer + __length, __length, __b.begin(), std::min<uint32_t>(__length, __b.size())), __length), __length);
+            _cyclic(__a.begin(), std::min<uint32_t>(__length, __a.size()), __b.begin(), std::min<uint32_t>(__length, __b.size()), __length);
             return poly(s_dftResultBuffer, s_dftResultBuffer + __length);
         }
+        static poly productFirst(const poly &__a, const poly &__b, uint32_t __n) {
+            const uint32_t a = std::min<uint32_t>(__a.size(), __n), b = std::min<uint32_t>(__b.size(), __n);
+            if (!a || !b) return poly();
+            const uint32_t total = a + b - 1, n = std::min(__n, total), length = std::__bit_floor(total), high = total - length;
+            if (!high || high > length / 2) {
+                const uint32_t len = std::__bit_ceil(total);
+                return poly(_cyclic(__a.begin(), a, __b.begin(), b, len), s_dftResultBuffer + n);
+            }
+            // 乘积的第 length 项及以上会绕回到低位；把乘积最高的 high 项单独算出来，从低位减去
+            poly ra(__a.begin() + (a - std::min(a, high)), __a.begin() + a), rb(__b.begin() + (b - std::min(b, high)), __b.begin() + b), res(n);
+            poly top(productFirst(ra.reverse(), rb.reverse(), high));
+            _cyclic(__a.begin(), a, __b.begin(), b, length);
+            for (uint32_t i = 0; i < std::min(n, length); i++) res[i] = s_dftResultBuffer[i];
+            for (uint32_t i = 0; i < high; i++) res[i] -= top.at(high - 1 - i);
+            for (uint32_t i = length; i < n; i++) res[i] = top.at(total - 1 - i);
+            return res;
+        }
+        static poly productMiddle(const poly &__a, const poly &__b) {
+            if (__b.empty() || __a.size() < __b.size()) return poly();
+            _cyclic(__a.begin(), __a.size(), __b.begin(), __b.size(), std::__bit_ceil(__a.size()));
+            return poly(s_dftResultBuffer + (__b.size() - 1), s_dftResultBuffer + __a.size());
+        }
         poly &shrink() {
             while (size() && !back()) pop_back();
             return *this;
@@ -168,7 +198,7 @@ namespace OY {
                 for (auto &a : *this) a *= __other;
             return *this;
         }
-        poly &operator*=(const poly &__other) { return (*this = product(*this, __other, std::__bit_ceil(size() + __other.size() - 1))).shrink(); }
+        poly &operator*=(const poly &__other) { return (*this = productFirst(*this, __other, size() + __other.size() - 1)).shrink(); }
         poly &operator/=(_Tp __other) {
             for (auto &a : *this) a /= __other;
             return *this;
@@ -195,7 +225,7 @@ namespace OY {
             return res;
         }
         friend poly operator*(const poly &__a, const poly &__b) {
-            poly res(product(__a, __b, std::__bit_ceil(__a.size() + __b.size() - 1)));
+            poly res(productFirst(__a, __b, __a.size() + __b.size() - 1));
             res.shrink();
             return res;
         }
@@ -292,7 +322,17 @@ namespace OY {
             if (size() < __other.size()) return {poly(), *this};
             std::pair<poly, poly> res;
             res.first = div(__other, size() - __other.size() + 1);
-            res.second = *this - res.first * __other;
+            // 余数项数少于除数，所以只需在模 x^length-1 意义下计算 f - q * g
+            if (const uint32_t m = __other.size() - 1) {
+                const uint32_t length = std::__bit_ceil(m);
+                poly q(length), g(length);
+                for (uint32_t i = 0; i < res.first.size(); i++) q[i & (length - 1)] += res.first[i];
+                for (uint32_t i = 0; i < __other.size(); i++) g[i & (length - 1)] += __other[i];
+                q = product(q, g, length), res.second.resize(length);
+                for (uint32_t i = 0; i < size(); i++) res.second[i & (length - 1)] += (*this)[i];
+                for (uint32_t i = 0; i < length; i++) res.second[i] -= q[i];
+                res.second.shrink();
+            }
             return res;
         }
         poly div(const poly &__other, uint32_t __length = -1) const {
@@ -43,7 +43,7 @@ namespace OY {
         constexpr _FastType raw_init(uint64_t __a) const { return reduce(_LongType(__a) * m_Ninv); }
         constexpr _FastType reduce(_LongType __a) const {
             _FastType res = (__a >> _MontgomeryTag<_ModType>::length) - _ModType(_LongType(_ModType(__a) * m_Pinv) * m_P >> _MontgomeryTag<_ModType>::length);
-            if (res >= mod()) res += mod();
+            if (res >= m_P) res += m_P;
             return res;
         }
         constexpr _ModType reduce(_FastType __a) const {
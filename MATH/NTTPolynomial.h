@@ -4,20 +4,94 @@
 #include <algorithm>
 #include <bit>
 #include <cstdint>
+#include <functional>
+#include <type_traits>
 
 namespace OY {
     template <typename _Tp, uint32_t _MAXN = 1 << 22>
     struct NTTPolynomial : std::vector<_Tp> {
         using poly = NTTPolynomial<_Tp, _MAXN>;
         using std::vector<_Tp>::vector, std::vector<_Tp>::begin, std::vector<_Tp>::end, std::vector<_Tp>::rbegin, std::vector<_Tp>::rend, std::vector<_Tp>::size, std::vector<_Tp>::back, std::vector<_Tp>::empty, std::vector<_Tp>::clear, std::vector<_Tp>::pop_back, std::vector<_Tp>::resize, std::vector<_Tp>::push_back;
-        static inline _Tp s_dftRoots[_MAXN], s_dftBuffer[_MAXN * 2], s_inverse[_MAXN + 1], s_treeBuffer[_MAXN * 2 * (std::__countr_zero(_MAXN))], s_primitiveRoot;
+        static inline _Tp s_dftRoots[_MAXN], s_dftBuffer[_MAXN * 2], s_inverse[_MAXN + 1], s_primitiveRoot;
         static inline uint32_t s_dftBin[_MAXN * 2], s_dftSize = 1, s_inverseSize = 0;
-        static inline poly s_treeSum;
+        template <typename _T, typename = void>
+        struct _HasVector : std::false_type {};
+        template <typename _T>
+        struct _HasVector<_T, std::void_t<typename _T::vector_type>> : std::true_type {};
+        template <typename _T, typename = void>
+        struct _HasConstexprRaw : std::false_type {};
+        template <typename _T>
+        struct _HasConstexprRaw<_T, std::void_t<std::integral_constant<bool, (_T::raw(1), true)>>> : std::true_type {};
+        static constexpr uint32_t s_smallLength = std::min<uint32_t>(_MAXN, 4096);
+        struct _SmallTable {
+            _Tp m_roots[s_smallLength], m_inverse[std::__countr_zero(s_smallLength) + 1];
+            uint32_t m_bin[s_smallLength * 2];
+        };
+        static constexpr bool _useSmallTable() {
+            if constexpr (_HasConstexprRaw<_Tp>::value)
+                return uint64_t(_Tp::mod()) >> 32 == 0 && (uint64_t(_Tp::mod()) - 1) % s_smallLength == 0;
+            else
+                return false;
+        }
+        static constexpr uint32_t _pow(uint64_t __a, uint64_t __n) {
+            const uint64_t P(_Tp::mod());
+            uint64_t res = 1;
+            for (__a %= P; __n; __n >>= 1, __a = __a * __a % P)
+                if (__n & 1) res = res * __a % P;
+            return res;
+        }
+        static constexpr uint32_t _smallestPrimitiveRoot() {
+            const uint32_t P(_Tp::mod());
+            uint32_t factors[32]{}, cnt = 0, x = P - 1;
+            for (uint32_t d = 2; uint64_t(d) * d <= x; d++)
+                if (x % d == 0) {
+                    factors[cnt++] = d;
+                    while (x % d == 0) x /= d;
+                }
+            if (x > 1) factors[cnt++] = x;
+            for (uint32_t g = 2;; g++) {
+                bool ok = true;
+                for (uint32_t i = 0; i != cnt && ok; i++) ok = _pow(g, (P - 1) / factors[i]) != 1;
+                if (ok) return g;
+            }
+        }
+        static constexpr _SmallTable _makeSmallTable() {
+            // 排布与 prepareDFT 相同，下标 [m, 2m) 存放 2m 次单位根的 0 到 m - 1 次幂，所以可以直接作为 s_dftRoots 的前缀
+            _SmallTable res{};
+            uint32_t roots[s_smallLength]{};
+            const uint32_t g = _smallestPrimitiveRoot();
+            if constexpr (s_smallLength > 1) roots[1] = 1;
+            for (uint32_t m = 2; m < s_smallLength; m *= 2) {
+                const uint64_t wn = _pow(g, (_Tp::mod() - 1) / (m * 2));
+                for (uint32_t i = m; i < m * 2; i += 2) roots[i] = roots[i / 2], roots[i + 1] = roots[i / 2] * wn % _Tp::mod();
+            }
+            for (uint32_t i = 0; i != s_smallLength; i++) res.m_roots[i] = _Tp::raw(roots[i]);
+            for (uint32_t k = 0, inv = 1; k <= std::__countr_zero(s_smallLength); k++, inv = (inv & 1 ? inv + uint64_t(_Tp::mod()) : inv) / 2) res.m_inverse[k] = _Tp::raw(inv);
+            for (uint32_t len = 2; len <= s_smallLength; len *= 2)
+                for (uint32_t i = 0; i < len; i += 2) {
+                    res.m_bin[len + i] = res.m_bin[len + i / 2] / 2;
+                    res.m_bin[len + i + 1] = res.m_bin[len + i / 2] / 2 + len / 2;
+                }
+            return res;
+        }
+        static const _SmallTable &_smallTable() {
+            static constexpr _SmallTable table = _makeSmallTable();
+            return table;
+        }
+        static _Tp _primitiveRoot() {
+            if constexpr (_useSmallTable()) {
+                constexpr uint32_t g = _smallestPrimitiveRoot();
+                return _Tp::raw(g);
+            } else
+                return s_primitiveRoot;
+        }
         static void prepareDFT(uint32_t __length) {
             if (__length > s_dftSize) {
+                if constexpr (_useSmallTable())
+                    if (s_dftSize == 1) std::copy_n(_smallTable().m_roots, s_smallLength, s_dftRoots), s_dftSize = s_smallLength;
                 if (s_dftSize == 1) s_dftRoots[s_dftSize++] = _Tp(1);
                 for (; s_dftSize < __length; s_dftSize *= 2) {
-                    const _Tp wn(s_primitiveRoot.pow((_Tp::mod() - 1) / (s_dftSize * 2)));
+                    const _Tp wn(_primitiveRoot().pow((_Tp::mod() - 1) / (s_dftSize * 2)));
                     for (uint32_t i = s_dftSize; i < s_dftSize * 2; i += 2) {
                         s_dftRoots[i] = s_dftRoots[i / 2];
                         s_dftRoots[i + 1] = s_dftRoots[i / 2] * wn;
@@ -30,35 +104,91 @@ namespace OY {
                     s_dftBin[__length + i + 1] = s_dftBin[__length + i / 2] / 2 + __length / 2;
                 }
         }
+        template <typename _Iterator, typename _Length, typename _Step>
+        static void _layer(_Iterator __iter, _Length __length, _Step __h, const _Tp *__roots) {
+            for (uint32_t j = 0; j < __length; j += __h) {
+                uint32_t k = j;
+                if constexpr (_HasVector<_Tp>::value) {
+                    // 元素类型提供了向量类型时，半长足够的层一次做 lanes 个蝴蝶
+                    using vec = typename _Tp::vector_type;
+                    if (__h / 2 >= vec::lanes)
+                        for (_Tp *p = &*(__iter + j); k < j + __h / 2; k += vec::lanes) {
+                            vec x(vec::load(p + (k - j))), y(vec::load(p + (k - j + __h / 2)) * vec::load(__roots + (__h / 2 + k - j)));
+                            (x + y).store(p + (k - j)), (x - y).store(p + (k - j + __h / 2));
+                        }
+                }
+                for (; k < j + __h / 2; k++) {
+                    _Tp x(*(__iter + k)), y(*(__iter + (k + __h / 2)) * __roots[__h / 2 + k - j]);
+                    *(__iter + k) += y;
+                    *(__iter + (k + __h / 2)) = x - y;
+                }
+            }
+        }
         template <typename _Iterator>
         static _Iterator _dft(_Iterator __iter, uint32_t __length) {
             for (uint32_t i = 0; i < __length; i++)
                 if (uint32_t j = s_dftBin[__length + i]; i < j) std::swap(*(__iter + i), *(__iter + j));
-            for (uint32_t h = 2; h <= __length; h *= 2)
-                for (uint32_t j = 0; j < __length; j += h)
-                    for (uint32_t k = j; k < j + h / 2; k++) {
-                        _Tp x(*(__iter + k)), y(*(__iter + (k + h / 2)) * s_dftRoots[h / 2 + k - j]);
-                        *(__iter + k) += y;
-                        *(__iter + (k + h / 2)) = x - y;
-                    }
+            for (uint32_t h = 2; h <= __length; h *= 2) _layer(__iter, __length, h, s_dftRoots);
+            return __iter;
+        }
+        template <uint32_t _Length, uint32_t _H, typename _Iterator>
+        static void _smallLayers(_Iterator __iter, const _Tp *__roots) {
+            if constexpr (_H <= _Length) {
+                _layer(__iter, std::integral_constant<uint32_t, _Length>(), std::integral_constant<uint32_t, _H>(), __roots);
+                _smallLayers<_Length, _H * 2>(__iter, __roots);
+            }
+        }
+        template <uint32_t _Length = s_smallLength, typename _Iterator>
+        static _Iterator _smallDft(_Iterator __iter, uint32_t __length) {
+            // 长度不超过 s_smallLength 时，按长度分派到各自实例化的变换，单位根与位逆序表都在编译期算好
+            if constexpr (_Length > 1)
+                if (__length != _Length) return _smallDft<_Length / 2>(__iter, __length);
+            const _SmallTable &table = _smallTable();
+            for (uint32_t i = 0; i != _Length; i++)
+                if (uint32_t j = table.m_bin[_Length + i]; i < j) std::swap(*(__iter + i), *(__iter + j));
+            _smallLayers<_Length, 2>(__iter, table.m_roots);
             return __iter;
         }
         template <typename _Iterator>
         static _Iterator _setHighZero(_Iterator __iter, uint32_t __length) { return std::fill_n(__iter + __length / 2, __length / 2, 0) - __length; }
         template <typename _Iterator>
-        static _Iterator dft(_Iterator __iter, uint32_t __length) { return prepareDFT(__length), _dft(__iter, __length); }
+        static _Iterator dft(_Iterator __iter, uint32_t __length) {
+            if constexpr (_useSmallTable())
+                if (__length <= s_smallLength) return _smallDft(__iter, __length);
+            return prepareDFT(__length), _dft(__iter, __length);
+        }
         template <typename _Iterator, typename _Iterator2>
         static _Iterator dft(_Iterator __iter, uint32_t __dftLength, _Iterator2 __source, uint32_t __sourceLength) { return dft(std::fill_n(std::copy_n(__source, __sourceLength, __iter), __dftLength - __sourceLength, 0) - __dftLength, __dftLength); }
         template <typename _Iterator>
-        static _Iterator idft(_Iterator __iter, uint32_t __length) {
-            _dft(__iter, __length);
+        static _Iterator _idftScale(_Iterator __iter, uint32_t __length, const _Tp &__inv) {
             std::reverse(__iter + 1, __iter + __length);
-            const _Tp inv(_Tp(__length).inv());
-            for (uint32_t i = 0; i < __length; i++) *(__iter + i) *= inv;
+            uint32_t i = 0;
+            if constexpr (_HasVector<_Tp>::value) {
+                using vec = typename _Tp::vector_type;
+                const vec v(vec::broadcast(__inv));
+                for (_Tp *p = &*__iter; i + vec::lanes <= __length; i += vec::lanes) (vec::load(p + i) * v).store(p + i);
+            }
+            for (; i < __length; i++) *(__iter + i) *= __inv;
             return __iter;
         }
+        template <typename _Iterator>
+        static _Iterator idft(_Iterator __iter, uint32_t __length) {
+            if constexpr (_useSmallTable())
+                if (__length <= s_smallLength) return _idftScale(_smallDft(__iter, __length), __length, _smallTable().m_inverse[std::__countr_zero(__length)]);
+            return _idftScale(_dft(__iter, __length), __length, _Tp(__length).inv());
+        }
         template <typename _Iterator, typename _Iterator2, typename _Operation>
-        static _Iterator _transform(_Iterator __iter1, _Iterator2 __iter2, uint32_t __length, _Operation __op = _Operation()) { return std::transform(__iter1, __iter1 + __length, __iter2, __iter1, __op) - __length; }
+        static _Iterator _transform(_Iterator __iter1, _Iterator2 __iter2, uint32_t __length, _Operation __op = _Operation()) {
+            if constexpr (_HasVector<_Tp>::value && std::is_same<_Operation, std::multiplies<_Tp>>::value) {
+                using vec = typename _Tp::vector_type;
+                uint32_t i = 0;
+                if (__length >= vec::lanes)
+                    for (_Tp *p = &*__iter1; i + vec::lanes <= __length; i += vec::lanes) (vec::load(p + i) * vec::load(&*(__iter2 + i))).store(p + i);
+                for (; i < __length; i++) *(__iter1 + i) *= *(__iter2 + i);
+                return __iter1;
+            } else
+                return std::transform(__iter1, __iter1 + __length, __iter2, __iter1, __op) - __length;
+        }
         static void prepareInverse(uint32_t __length) {
             if (s_inverseSize >= __length) return;
             if (!s_inverseSize) s_inverse[0] = s_inverse[++s_inverseSize] = _Tp(1);
@@ -87,6 +217,23 @@ namespace OY {
             idft(_transform(dft(s_dftBuffer, __length, __a.begin(), std::min<uint32_t>(__length, __a.size())), dft(s_dftBuffer + __length, __length, __b.begin(), std::min<uint32_t>(__length, __b.size())), __length, std::multiplies<_Tp>()), __length);
             return poly(s_dftBuffer, s_dftBuffer + __length);
         }
+        struct TransformedPolynomial {
+            uint32_t m_size = 0, m_length = 0;
+            poly m_dft;
+            TransformedPolynomial() = default;
+            template <typename _Iterator>
+            // 变换长度至少取 __size 两倍的二的幂，避免截断卷积核，也保证重叠相加时每段至少前进 __size + 1 项
+            TransformedPolynomial(_Iterator __first, uint32_t __size, uint32_t __length) : m_size(__size), m_length(std::max(__length, std::__bit_ceil(__size * 2))), m_dft(m_length) { dft(m_dft.begin(), m_length, __first, m_size); }
+            TransformedPolynomial(const poly &__a, uint32_t __length) : TransformedPolynomial(__a.begin(), __a.size(), __length) {}
+            uint32_t size() const { return m_size; }
+            uint32_t length() const { return m_length; }
+        };
+        static poly product(const poly &__a, const TransformedPolynomial &__b) {
+            if (__a.empty() || !__b.m_size) return poly();
+            const uint32_t length = __b.m_length;
+            idft(_transform(dft(s_dftBuffer, length, __a.begin(), std::min<uint32_t>(length, __a.size())), __b.m_dft.begin(), length, std::multiplies<_Tp>()), length);
+            return poly(s_dftBuffer, s_dftBuffer + length);
+        }
         poly &shrink() {
             while (size() && !back()) pop_back();
             return *this;
@@ -127,6 +274,7 @@ namespace OY {
             return *this;
         }
         poly &operator*=(const poly &__other) { return (*this = product(*this, __other, std::__bit_ceil(size() + __other.size() - 1))).shrink(); }
+        poly &operator*=(const TransformedPolynomial &__other) { return *this = *this * __other; }
         poly &operator/=(_Tp __other) {
             for (auto &a : *this) a /= __other;
             return *this;
@@ -157,6 +305,19 @@ namespace OY {
             res.shrink();
             return res;
         }
+        friend poly operator*(const poly &__a, const TransformedPolynomial &__b) {
+            if (__a.empty() || !__b.m_size) return poly();
+            // 把 __a 切成若干段，每段与 __b 的乘积恰好不超过变换长度，逐段相乘后叠加
+            const uint32_t length = __b.m_length, step = length - __b.m_size + 1;
+            poly res(__a.size() + __b.m_size - 1);
+            for (uint32_t i = 0; i < __a.size(); i += step) {
+                const uint32_t cur = std::min<uint32_t>(step, __a.size() - i);
+                idft(_transform(dft(s_dftBuffer, length, __a.begin() + i, cur), __b.m_dft.begin(), length, std::multiplies<_Tp>()), length);
+                _transform(res.begin() + i, s_dftBuffer, cur + __b.m_size - 1, std::plus<_Tp>());
+            }
+            res.shrink();
+            return res;
+        }
         friend poly operator/(const poly &__a, _Tp __b) {
             poly res(__a);
             res /= __b;
@@ -318,48 +479,98 @@ namespace OY {
             std::copy_n(a.begin(), a.size(), res.begin() + (size() - rest));
             return res;
         }
-        static void _initTree(const poly &__xs, uint32_t __length) {
-            _Tp *it = s_treeBuffer + __length * 2 * std::__countr_zero(__length / 2);
-            for (uint32_t i = 0; i < __length; i++) *it++ = _Tp(1), *it++ = -__xs.at(i);
-            for (uint32_t h = 2; h < __length; h *= 2) {
-                _Tp *it = s_treeBuffer + __length * 2 * std::__countr_zero(__length / 2 / h);
-                for (uint32_t i = 0; i < __length; i += h, it += h * 2) {
-                    idft(std::fill_n(std::transform(dft(it + __length * 2, h), it + __length * 2 + h, dft(it + __length * 2 + h, h), it, std::multiplies<_Tp>()), h, 0) - h * 2, h);
-                    *(it + h) = *it - 1, *it = 1;
+        struct SubproductTree {
+            uint32_t m_size, m_length;
+            poly m_tree, m_sum, m_weight;
+            SubproductTree(const poly &__xs) : m_size(__xs.size()), m_length(std::max<uint32_t>(2, std::__bit_ceil(__xs.size()))) {
+                const uint32_t length = m_length;
+                m_tree.resize(length * 2 * std::__countr_zero(length));
+                _Tp *tree = m_tree.data(), *it = tree + length * 2 * std::__countr_zero(length / 2);
+                for (uint32_t i = 0; i < length; i++) *it++ = _Tp(1), *it++ = -__xs.at(i);
+                for (uint32_t h = 2; h < length; h *= 2) {
+                    _Tp *it = tree + length * 2 * std::__countr_zero(length / 2 / h);
+                    for (uint32_t i = 0; i < length; i += h, it += h * 2) {
+                        idft(std::fill_n(std::transform(dft(it + length * 2, h), it + length * 2 + h, dft(it + length * 2 + h, h), it, std::multiplies<_Tp>()), h, 0) - h * 2, h);
+                        *(it + h) = *it - 1, *it = 1;
+                    }
                 }
+                idft(std::transform(dft(tree, length), tree + length, dft(tree + length, length), m_sum.sizeTo(length * 2).begin(), std::multiplies<_Tp>()) - length, length);
+                m_sum[length] = m_sum[0] - _Tp(1), m_sum[0] = _Tp(1);
+                m_sum.resize(length + 1);
             }
-            idft(std::transform(dft(s_treeBuffer, __length), s_treeBuffer + __length, dft(s_treeBuffer + __length, __length), s_treeSum.sizeTo(__length * 2).begin(), std::multiplies<_Tp>()) - __length, __length);
-            s_treeSum[__length] = s_treeSum[0] - _Tp(1);
-            s_treeSum[0] = _Tp(1);
-        }
-        static poly _calcTree(const poly &__f, uint32_t __resLength) {
-            const uint32_t length = std::__bit_ceil(std::max<uint32_t>(__f.size(), s_treeSum.size() / 2));
-            poly res(length);
-            std::copy_n(__f.div(s_treeSum.reverse()).reverse().begin(), __f.size(), res.begin() + length - __f.size());
-            for (uint32_t h = length / 2; h; h /= 2)
-                for (_Tp *it = res.data(), *end = res.data() + __resLength, *it2 = s_treeBuffer + length * 2 * std::__countr_zero(length / 2 / h); it < end; it += h * 2, it2 += h * 4) std::copy_n(s_dftBuffer + h, h, std::copy_n(idft(_transform(idft(_transform(std::copy_n(it2 + h * 2, h * 2, std::copy_n(it2, h * 2, s_dftBuffer)) - h * 4, dft(it, h * 2), h * 2, std::multiplies<_Tp>()), h * 2) + h * 2, it, h * 2, std::multiplies<_Tp>()), h * 2) + h, h, it));
-            res.sizeTo(__resLength);
-            return res;
-        }
+            poly calc(const poly &__f) const {
+                if (__f.empty()) return poly(m_size);
+                if (__f.size() > m_length) return calc(__f.mod(poly(m_sum).reverse()));
+                const uint32_t length = m_length;
+                poly res(length);
+                std::copy_n(__f.div(poly(m_sum).reverse()).reverse().begin(), __f.size(), res.begin() + length - __f.size());
+                for (uint32_t h = length / 2; h; h /= 2) {
+                    const _Tp *it2 = m_tree.data() + length * 2 * std::__countr_zero(length / 2 / h);
+                    for (_Tp *it = res.data(), *end = res.data() + m_size; it < end; it += h * 2, it2 += h * 4) std::copy_n(s_dftBuffer + h, h, std::copy_n(idft(_transform(idft(_transform(std::copy_n(it2 + h * 2, h * 2, std::copy_n(it2, h * 2, s_dftBuffer)) - h * 4, dft(it, h * 2), h * 2, std::multiplies<_Tp>()), h * 2) + h * 2, it, h * 2, std::multiplies<_Tp>()), h * 2) + h, h, it));
+                }
+                res.sizeTo(m_size);
+                return res;
+            }
+            poly interpolate(const poly &__ys) {
+                if (m_weight.size() != m_size) {
+                    // 各点处根多项式导数值的逆元，只需要计算一次
+                    poly d(calc(poly(m_sum).sizeTo(m_size + 1).reverse().derivate()));
+                    m_weight.resize(m_size);
+                    _Tp prod(1);
+                    for (uint32_t i = 0; i < m_size; i++) m_weight[i] = prod, prod *= d[i];
+                    prod = prod.inv();
+                    for (uint32_t i = m_size - 1; ~i; i--) m_weight[i] *= prod, prod *= d[i];
+                }
+                const uint32_t length = m_length;
+                poly res(length);
+                for (uint32_t i = 0, iend = std::min<uint32_t>(m_size, __ys.size()); i < iend; i++) res[i] = __ys[i] * m_weight[i];
+                for (uint32_t h = 1; h < length; h *= 2) {
+                    const _Tp *it2 = m_tree.data() + length * 2 * std::__countr_zero(length / 2 / h);
+                    for (_Tp *it = res.data(), *end = res.data() + m_size; it < end; it += h * 2, it2 += h * 4) {
+                        dft(dft(s_dftBuffer, h * 2, it, h) + h * 2, h * 2, it + h, h);
+                        for (uint32_t i = 0; i < h * 2; i++) *(it + i) = s_dftBuffer[i] * *(it2 + (h * 2 + i)) + s_dftBuffer[h * 2 + i] * *(it2 + i);
+                        idft(it, h * 2);
+                    }
+                }
+                res.sizeTo(m_size).reverse();
+                return res;
+            }
+            uint32_t size() const { return m_size; }
+        };
         static poly fromPoints(const poly &__xs, const poly &__ys) {
             if (__xs.size() <= 1) return __ys;
-            const uint32_t length = std::__bit_ceil(__xs.size());
-            _initTree(__xs, length);
-            poly res(_calcTree(poly(s_treeSum).sizeTo(__xs.size() + 1).reverse().derivate(), __xs.size()).sizeTo(length));
-            for (uint32_t i = 0; i < __ys.size(); i++) res[i] = __ys[i] / res[i];
-            for (uint32_t h = 1; h < length; h *= 2)
-                for (_Tp *it = res.data(), *end = res.data() + __xs.size(), *it2 = s_treeBuffer + length * 2 * std::__countr_zero(length / 2 / h); it < end; it += h * 2, it2 += h * 4) {
-                    dft(dft(s_dftBuffer, h * 2, it, h) + h * 2, h * 2, it + h, h);
-                    for (uint32_t i = 0; i < h * 2; i++) *(it + i) = s_dftBuffer[i] * *(it2 + (h * 2 + i)) + s_dftBuffer[h * 2 + i] * *(it2 + i);
-                    idft(it, h * 2);
+            return SubproductTree(__xs).interpolate(__ys);
+        }
+        poly calc(const poly &__xs) const { return SubproductTree(__xs).calc(*this); }
+        struct RelaxedConvolution {
+            static constexpr uint32_t naive_limit = 32;
+            poly m_f, m_g, m_h;
+            std::vector<TransformedPolynomial> m_gDft;
+            RelaxedConvolution(const poly &__g) : m_g(__g) {}
+            _Tp push(_Tp __x) {
+                const uint32_t n = m_f.size();
+                m_f.push_back(__x);
+                if (m_h.size() < n + 2) m_h.resize(n + 2);
+                // f 中以 n 结尾、长为 len 的对齐块，负责与 g[len, len * 2) 的全部乘积
+                for (uint32_t len = 1, k = 0; !((n + 1) & (len - 1)) && len < m_g.size(); len *= 2, k++) {
+                    const uint32_t glen = std::min<uint32_t>(len, m_g.size() - len);
+                    const _Tp *f = m_f.data() + (n + 1 - len), *g = m_g.data() + len;
+                    if (m_h.size() < n + len * 2) m_h.resize(n + len * 2);
+                    _Tp *h = m_h.data() + (n + 1);
+                    if (len <= naive_limit)
+                        for (uint32_t i = 0; i < len; i++)
+                            for (uint32_t j = 0; j < glen; j++) h[i + j] += f[i] * g[j];
+                    else {
+                        if (m_gDft.size() <= k) m_gDft.resize(k + 1);
+                        if (!m_gDft[k].length()) m_gDft[k] = TransformedPolynomial(g, glen, len * 2);
+                        idft(_transform(dft(s_dftBuffer, len * 2, f, len), m_gDft[k].m_dft.begin(), len * 2, std::multiplies<_Tp>()), len * 2);
+                        _transform(h, s_dftBuffer, len * 2 - 1, std::plus<_Tp>());
+                    }
                 }
-            res.sizeTo(__xs.size()).reverse();
-            return res;
-        }
-        poly calc(const poly &__xs) const {
-            _initTree(__xs, std::__bit_ceil(std::max<uint32_t>(__xs.size(), size())));
-            return _calcTree(*this, __xs.size());
-        }
+                return m_h[n + 1];
+            }
+            uint32_t size() const { return m_f.size(); }
+        };
     };
 }
 
@@ -1,6 +1,6 @@
 /*
 最后修改:
-20231127
+20261019
 测试环境:
 gcc11.2,c++11
 clang12.0,C++11
@@ -11,6 +11,7 @@ msvc14.2,C++14
 
 #include <algorithm>
 #include <cstdint>
+#include <memory>
 #include <numeric>
 #include <random>
 
@@ -73,9 +74,9 @@ namespace OY {
             uint64_t v0, v1 = mul(distribute(pr_rand), ninv), prod = mul(1, ninv), c = mul(distribute(pr_rand), ninv);
             for (size_t i = 1; i != batch; i <<= 1) {
                 v0 = v1;
-                for (size_t j = 0; j != i; j++) v1 = mul(v1, v1) + c;
+                for (size_t j = 0; j != i; j++) v1 = mul(v1, v1) + c, v1 = v1 >= n ? v1 - n : v1;
                 for (size_t j = 0; j != i; j++) {
-                    v1 = mul(v1, v1) + c;
+                    v1 = mul(v1, v1) + c, v1 = v1 >= n ? v1 - n : v1;
                     prod = mul(prod, v0 > v1 ? v0 - v1 : v1 - v0);
                     if (!prod) return pick(n);
                 }
@@ -84,10 +85,10 @@ namespace OY {
             }
             for (size_t i = batch;; i <<= 1) {
                 v0 = v1;
-                for (size_t j = 0; j != i; j++) v1 = mul(v1, v1) + c;
+                for (size_t j = 0; j != i; j++) v1 = mul(v1, v1) + c, v1 = v1 >= n ? v1 - n : v1;
                 for (size_t j = 0; j != i; j += batch) {
                     for (size_t k = 0; k != batch; k++) {
-                        v1 = mul(v1, v1) + c;
+                        v1 = mul(v1, v1) + c, v1 = v1 >= n ? v1 - n : v1;
                         prod = mul(prod, v0 > v1 ? v0 - v1 : v1 - v0);
                         if (!prod) return pick(n);
                     }
@@ -97,6 +98,56 @@ namespace OY {
             }
             return n;
         }
+        template <size_t Lanes = 4>
+        void pick_batch(const uint64_t *first, const uint64_t *last, uint64_t *res) {
+            // 每条通道独立地执行与 pick 相同的 Brent 流程，所有通道同步地各走一步；某条通道找到因数后立即换入下一个数
+            struct lane {
+                Montgomery64 m_lane;
+                uint64_t m_c, m_v0, m_v1, m_prod, m_len, m_step;
+                uint32_t m_id;
+                bool m_mul;
+            };
+            const uint32_t total = last - first;
+            uint32_t cursor = 0, active = 0;
+            lane lanes[Lanes];
+            bool busy[Lanes]{};
+            auto restart = [&](lane &x) {
+                std::uniform_int_distribution<uint64_t> distribute(2, x.m_lane.mod() - 1);
+                x.m_v0 = x.m_v1 = x.m_lane.raw_init(distribute(pr_rand)), x.m_c = x.m_lane.raw_init(distribute(pr_rand)), x.m_prod = x.m_lane.raw_init(1), x.m_len = 1, x.m_step = 0, x.m_mul = false;
+            };
+            auto load = [&](uint32_t l) {
+                while (cursor != total && !(first[cursor] & 1)) res[cursor++] = 2;
+                if (cursor == total) return false;
+                lanes[l].m_id = cursor, lanes[l].m_lane = Montgomery64(first[cursor++]), restart(lanes[l]);
+                return true;
+            };
+            for (uint32_t l = 0; l != Lanes; l++)
+                if (load(l)) busy[l] = true, active++;
+            while (active) {
+                for (uint32_t l = 0; l != Lanes; l++) {
+                    if (!busy[l]) continue;
+                    lane &x = lanes[l];
+                    x.m_v1 = x.m_lane.multiply(x.m_v1, x.m_v1) + x.m_c, x.m_v1 = x.m_v1 >= x.m_lane.mod() ? x.m_v1 - x.m_lane.mod() : x.m_v1;
+                    if (!x.m_mul) {
+                        if (++x.m_step == x.m_len) x.m_mul = true, x.m_step = 0;
+                        continue;
+                    }
+                    x.m_prod = x.m_lane.multiply(x.m_prod, x.m_v0 > x.m_v1 ? x.m_v0 - x.m_v1 : x.m_v1 - x.m_v0);
+                    if (!x.m_prod) {
+                        restart(x);
+                        continue;
+                    }
+                    if (++x.m_step == x.m_len || !(x.m_step % batch)) {
+                        uint64_t g = std::gcd(x.m_prod, x.m_lane.mod());
+                        if (g > 1) {
+                            res[x.m_id] = g;
+                            if (!load(l)) busy[l] = false, active--;
+                        } else if (x.m_step == x.m_len)
+                            x.m_v0 = x.m_v1, x.m_len <<= 1, x.m_step = 0, x.m_mul = false;
+                    }
+                }
+            }
+        }
         void _dfs(uint64_t cur, std::vector<PollardRhoPair> &pairs) {
             if (!is_prime(cur)) {
                 uint64_t a = pick(cur);
@@ -120,6 +171,54 @@ namespace OY {
             if constexpr (Sorted) std::sort(res.begin(), res.end());
             return res;
         }
+        template <bool Sorted = false, size_t Lanes = 4>
+        std::vector<std::vector<PollardRhoPair>> decomposite_batch(const std::vector<uint64_t> &ns) {
+            static constexpr uint64_t small_primes[] = {3, 5, 7, 11, 13, 17, 19, 23, 29, 31, 37, 41, 43, 47, 53, 59, 61};
+            std::vector<std::vector<PollardRhoPair>> res(ns.size());
+            std::vector<uint64_t> cur, comp, factor;
+            std::vector<uint32_t> owner, comp_owner;
+            auto add = [&](std::vector<PollardRhoPair> &pairs, uint64_t p) {
+                auto find = std::find_if(pairs.begin(), pairs.end(), [&](const PollardRhoPair &x) { return x.m_prime == p; });
+                if (find == pairs.end())
+                    pairs.push_back({p, 1});
+                else
+                    find->m_count++;
+            };
+            for (uint32_t i = 0; i != ns.size(); i++) {
+                uint64_t n = ns[i];
+                if (!n) continue;
+                if (n % 2 == 0) {
+                    uint32_t ctz = std::countr_zero(n);
+                    res[i].push_back({uint64_t(2), ctz}), n >>= ctz;
+                }
+                for (uint64_t p : small_primes)
+                    if (n % p == 0) {
+                        uint32_t cnt = 0;
+                        do n /= p, cnt++;
+                        while (n % p == 0);
+                        res[i].push_back({p, cnt});
+                    }
+                if (n > 1) cur.push_back(n), owner.push_back(i);
+            }
+            // 每轮先对所有待分解的数批量判素，再对其中的合数批量找出一个因数，拆成的两部分进入下一轮
+            while (cur.size()) {
+                std::unique_ptr<bool[]> is_p(new bool[cur.size()]);
+                is_prime64_batch<Lanes>(cur.data(), cur.data() + cur.size(), is_p.get());
+                comp.clear(), comp_owner.clear();
+                for (uint32_t i = 0; i != cur.size(); i++)
+                    if (is_p[i])
+                        add(res[owner[i]], cur[i]);
+                    else
+                        comp.push_back(cur[i]), comp_owner.push_back(owner[i]);
+                factor.resize(comp.size());
+                pick_batch<Lanes>(comp.data(), comp.data() + comp.size(), factor.data());
+                cur.clear(), owner.clear();
+                for (uint32_t i = 0; i != comp.size(); i++) cur.push_back(factor[i]), cur.push_back(comp[i] / factor[i]), owner.push_back(comp_owner[i]), owner.push_back(comp_owner[i]);
+            }
+            if constexpr (Sorted)
+                for (auto &pairs : res) std::sort(pairs.begin(), pairs.end());
+            return res;
+        }
         template <typename Callback>
         void _dfs(uint32_t index, uint64_t prod, const std::vector<PollardRhoPair> &pairs, Callback &&call) {
             if (index == pairs.size())
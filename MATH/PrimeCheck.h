@@ -1,6 +1,6 @@
 /*
 最后修改:
-20231126
+20261019
 测试环境:
 gcc11.2,c++11
 clang12.0,C++11
@@ -13,8 +13,10 @@ msvc14.2,C++14
 #include <cstdint>
 #include <initializer_list>
 #include <numeric>
+#include <vector>
 
 #include "../TEST/std_bit.h"
+#include "Montgomery.h"
 
 namespace OY {
     bool is_prime32(uint32_t n) {
@@ -110,6 +112,57 @@ namespace OY {
         }
         return true;
     }
+    template <size_t Lanes = 4>
+    void is_prime64_batch(const uint64_t *first, const uint64_t *last, bool *res) {
+        struct node {
+            Montgomery64 m_lane;
+            uint64_t m_one, m_d;
+            uint32_t m_s, m_id;
+        };
+        std::vector<node> alive, next;
+        for (uint32_t i = 0; i != last - first; i++) {
+            uint64_t n = first[i];
+            if (n < uint64_t(1) << 31)
+                res[i] = is_prime32(n);
+            else if (n % 2 == 0 || n % 3 == 0 || n % 5 == 0 || n % 7 == 0)
+                res[i] = false;
+            else {
+                node x;
+                x.m_lane = Montgomery64(n), x.m_one = x.m_lane.raw_init(1), x.m_s = std::countr_zero(n - 1), x.m_d = (n - 1) >> x.m_s, x.m_id = i;
+                res[i] = true, alive.push_back(x);
+            }
+        }
+        // 每 Lanes 个数一组同步地做快速幂，组内各数的乘法互不依赖，可以填满乘法器的流水线；每轮只保留仍可能为质数的数
+        for (uint64_t a : {2, 325, 9375, 28178, 450775, 9780504}) {
+            next.clear();
+            for (uint32_t i = 0; i < alive.size(); i += Lanes) {
+                Montgomery64 lane[Lanes];
+                uint64_t d[Lanes], one[Lanes], base[Lanes], x[Lanes];
+                uint32_t cnt[Lanes], bits = 0, s = 0;
+                bool pass[Lanes];
+                for (uint32_t l = 0; l != Lanes; l++) {
+                    const node &cur = alive[std::min<uint32_t>(i + l, alive.size() - 1)];
+                    lane[l] = cur.m_lane, d[l] = cur.m_d, one[l] = cur.m_one, cnt[l] = cur.m_s;
+                    base[l] = lane[l].raw_init(a), x[l] = one[l];
+                    bits = std::max<uint32_t>(bits, std::bit_width(d[l])), s = std::max(s, cnt[l]);
+                }
+                for (uint32_t b = 0; b != bits; b++)
+                    for (uint32_t l = 0; l != Lanes; l++) {
+                        const uint64_t t = lane[l].multiply(x[l], base[l]);
+                        x[l] = d[l] >> b & 1 ? t : x[l], base[l] = lane[l].multiply(base[l], base[l]);
+                    }
+                for (uint32_t l = 0; l != Lanes; l++) pass[l] = x[l] == one[l] || x[l] == lane[l].mod() - one[l];
+                for (uint32_t r = 1; r < s; r++)
+                    for (uint32_t l = 0; l != Lanes; l++) x[l] = lane[l].multiply(x[l], x[l]), pass[l] |= r < cnt[l] && x[l] == lane[l].mod() - one[l];
+                for (uint32_t l = 0; l != Lanes && i + l != alive.size(); l++)
+                    if (pass[l])
+                        next.push_back(alive[i + l]);
+                    else
+                        res[alive[i + l].m_id] = false;
+            }
+            std::swap(alive, next);
+        }
+    }
     template <typename Tp>
     bool is_prime(Tp n) {
         if constexpr (std::is_same<Tp, uint32_t>::value)
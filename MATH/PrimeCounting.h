@@ -0,0 +1,132 @@
+/*
+最后修改:
+20261019
+测试环境:
+gcc11.2,c++17
+clang12.0,C++17
+msvc14.2,C++17
+*/
+#ifndef __OY_PRIMECOUNTING__
+#define __OY_PRIMECOUNTING__
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+#include "FastSieve.h"
+
+namespace OY {
+    namespace PRIMECOUNT {
+        using size_type = uint32_t;
+        static constexpr size_type parallel_limit = 1 << 14;
+        inline size_type isqrt(uint64_t x) {
+            uint64_t r = sqrtl(x);
+            while (r * r > x) r--;
+            while ((r + 1) * (r + 1) <= x) r++;
+            return r;
+        }
+        template <typename Tp, size_type ThreadNum = 1>
+        struct LucyTable {
+            uint64_t m_n;
+            size_type m_sqrt;
+            std::vector<size_type> m_primes;
+            std::vector<Tp> m_small, m_large;
+            template <typename Callback>
+            static void _parallel_do(size_type first, size_type last, Callback &&call) {
+                if constexpr (ThreadNum == 1)
+                    call(first, last);
+                else if (last - first < parallel_limit)
+                    call(first, last);
+                else {
+                    std::vector<std::thread> threads;
+                    const size_type block = (last - first + ThreadNum - 1) / ThreadNum;
+                    for (size_type i = first; i < last; i += block) threads.emplace_back(call, i, std::min(last, i + block));
+                    for (auto &t : threads) t.join();
+                }
+            }
+            template <typename InitMapping, typename PrimeMapping>
+            LucyTable(uint64_t n, InitMapping &&init, PrimeMapping &&prime) : m_n(n), m_sqrt(isqrt(n)), m_small(m_sqrt + 1), m_large(m_sqrt + 1) {
+                const size_type sq = m_sqrt;
+                SIEVE::SegmentedSieve<>().enumerate(2, uint64_t(sq) + 1, [&](uint64_t p) { m_primes.push_back(p); });
+                // 在 2^53 以内，双精度浮点数的除法向下取整后与整数除法结果相同
+                const double nd = n;
+                for (size_type v = 1; v <= sq; v++) m_small[v] = init(uint64_t(v));
+                for (size_type i = 1; i <= sq; i++) m_large[i] = init(n / i);
+                for (size_type p : m_primes) {
+                    const uint64_t p2 = uint64_t(p) * p;
+                    if (p2 > n) break;
+                    const Tp c = m_small[p - 1], fp = prime(p);
+                    const size_type lim = std::min<uint64_t>(sq, n / p2);
+                    auto large_work = [&](size_type first, size_type last) {
+                        for (size_type i = first; i != last; i++) {
+                            const uint64_t d = uint64_t(i) * p;
+                            m_large[i] -= fp * ((d <= sq ? m_large[d] : m_small[uint64_t(nd / d)]) - c);
+                        }
+                    };
+                    // large[i] 要读取本轮尚未更新的 large[i * p] ，所以按 (lim / p^(k+1), lim / p^k] 分层，自低层向高层处理，层内可以并行
+                    std::vector<size_type> bounds{lim};
+                    while (bounds.back()) bounds.push_back(bounds.back() / p);
+                    for (size_type k = bounds.size() - 1; k; k--) _parallel_do(bounds[k] + 1, bounds[k - 1] + 1, large_work);
+                    if (p2 > sq) continue;
+                    auto small_work = [&](size_type first, size_type last) {
+                        for (size_type v = last - 1; v >= first; v--) m_small[v] -= fp * (m_small[v / p] - c);
+                    };
+                    // small[v] 要读取本轮尚未更新的 small[v / p] ，所以自高层向低层处理
+                    for (size_type hi = sq; hi >= p2;) {
+                        const size_type lo = std::max<size_type>(hi / p, p2 - 1);
+                        _parallel_do(lo + 1, hi + 1, small_work);
+                        hi = lo;
+                    }
+                }
+            }
+            uint64_t n() const { return m_n; }
+            size_type sqrt() const { return m_sqrt; }
+            const std::vector<size_type> &primes() const { return m_primes; }
+            const Tp &query(uint64_t v) const { return v <= m_sqrt ? m_small[v] : m_large[m_n / v]; }
+        };
+        template <size_type ThreadNum = 1>
+        uint64_t prime_count(uint64_t n) {
+            if (n < 2) return 0;
+            LucyTable<uint64_t, ThreadNum> table(n, [](uint64_t v) { return v - 1; }, [](size_type) { return uint64_t(1); });
+            return table.query(n);
+        }
+        template <typename Tp, size_type ThreadNum = 1>
+        Tp prime_sum(uint64_t n) {
+            if (n < 2) return Tp(0);
+            LucyTable<Tp, ThreadNum> table(n, [](uint64_t v) { return (v & 1 ? Tp(v) * Tp((v + 1) / 2) : Tp(v / 2) * Tp(v + 1)) - Tp(1); }, [](size_type p) { return Tp(p); });
+            return table.query(n);
+        }
+        template <typename Tp, typename PrimeSum, typename Mapping>
+        struct Min25Solver {
+            uint64_t m_n;
+            const std::vector<size_type> &m_primes;
+            PrimeSum &m_prime_sum;
+            Mapping &m_map;
+            std::vector<Tp> m_pre;
+            Min25Solver(uint64_t n, const std::vector<size_type> &primes, PrimeSum &prime_sum, Mapping &map) : m_n(n), m_primes(primes), m_prime_sum(prime_sum), m_map(map), m_pre(primes.size() + 1, Tp(0)) {
+                for (size_type i = 0; i != primes.size(); i++) m_pre[i + 1] = m_pre[i] + m_map(uint64_t(primes[i]), 1, uint64_t(primes[i]));
+            }
+            Tp _dfs(uint64_t v, size_type j) {
+                // 求所有最小质因子不小于第 j 个质数的 i∈[2, v] 的 f(i) 之和
+                if (j != m_primes.size() && m_primes[j] > v) return Tp(0);
+                Tp res = m_prime_sum(v) - m_pre[j];
+                for (size_type k = j; k != m_primes.size() && uint64_t(m_primes[k]) * m_primes[k] <= v; k++) {
+                    const uint64_t p = m_primes[k];
+                    uint64_t pe = p;
+                    for (size_type e = 1; pe * p <= v; e++, pe *= p) res += m_map(p, e, pe) * _dfs(v / pe, k + 1) + m_map(p, e + 1, pe * p);
+                }
+                return res;
+            }
+        };
+        template <typename Tp, typename PrimeSum, typename Mapping>
+        Tp Min25_sum(uint64_t n, const std::vector<size_type> &primes, PrimeSum &&prime_sum, Mapping &&map) {
+            if (n < 2) return Tp(n);
+            Min25Solver<Tp, PrimeSum, Mapping> solver(n, primes, prime_sum, map);
+            return solver._dfs(n, 0) + Tp(1);
+        }
+    }
+}
+
+#endif
@@ -1,6 +1,6 @@
 /*
 最后修改:
-20231120
+20261019
 测试环境:
 gcc11.2,c++11
 clang12.0,C++11
@@ -21,7 +21,7 @@ namespace OY {
         using mod_type = uint32_t;
         mod_type m_val;
         static mod_type _mul(mod_type a, mod_type b) { return uint64_t(a) * b % mod(); }
-        StaticModInt32() : m_val{} {}
+        constexpr StaticModInt32() : m_val{} {}
         template <typename Tp, typename std::enable_if<std::is_signed<Tp>::value>::type * = nullptr>
         StaticModInt32(Tp val) : m_val{} {
             auto x = val % int32_t(mod());
@@ -30,7 +30,7 @@ namespace OY {
         }
         template <typename Tp, typename std::enable_if<std::is_unsigned<Tp>::value>::type * = nullptr>
         StaticModInt32(Tp val) : m_val{val % mod()} {}
-        static mint raw(mod_type val) {
+        static constexpr mint raw(mod_type val) {
             mint res;
             res.m_val = val;
             return res;
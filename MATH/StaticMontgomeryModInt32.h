@@ -1,6 +1,6 @@
 /*
 最后修改:
-20231120
+20261019
 测试环境:
 gcc11.2,c++11
 clang12.0,C++11
@@ -14,10 +14,21 @@ msvc14.2,C++14
 #include <cstdint>
 #include <limits>
 
+#ifdef __AVX2__
+#include <immintrin.h>
+#endif
+
 namespace OY {
+#ifdef __AVX2__
+    template <uint32_t P, bool IsPrime>
+    struct StaticMontgomeryModInt32Vector;
+#endif
     template <uint32_t P, bool IsPrime, typename = typename std::enable_if<(P % 2 && P > 1 && P < uint32_t(1) << 31)>::type>
     struct StaticMontgomeryModInt32 {
         using mint = StaticMontgomeryModInt32<P, IsPrime>;
+#ifdef __AVX2__
+        using vector_type = StaticMontgomeryModInt32Vector<P, IsPrime>;
+#endif
         using mod_type = uint32_t;
         using fast_type = mod_type;
         using long_type = uint64_t;
@@ -27,19 +38,19 @@ namespace OY {
         fast_type m_val;
         static mod_type _mod(uint64_t val) { return val % mod(); }
         static fast_type _init(uint64_t val) { return _raw_init(_mod(val)); }
-        static fast_type _raw_init(mod_type val) { return _mul(val, ninv); }
+        static constexpr fast_type _raw_init(mod_type val) { return _mul(val, ninv); }
         static mod_type _reduce(fast_type val) {
             mod_type res = -mod_type((long_type(val * pinv) * mod()) >> 32);
             if (res >= mod()) res += mod();
             return res;
         }
-        static fast_type _reduce_long(long_type val) {
+        static constexpr fast_type _reduce_long(long_type val) {
             fast_type res = (val >> 32) - mod_type((long_type(mod_type(val) * pinv) * mod()) >> 32);
             if (res >= mod()) res += mod();
             return res;
         }
-        static fast_type _mul(fast_type a, fast_type b) { return _reduce_long(long_type(a) * b); }
-        StaticMontgomeryModInt32() : m_val{} {}
+        static constexpr fast_type _mul(fast_type a, fast_type b) { return _reduce_long(long_type(a) * b); }
+        constexpr StaticMontgomeryModInt32() : m_val{} {}
         template <typename Tp, typename std::enable_if<std::is_signed<Tp>::value>::type * = nullptr>
         StaticMontgomeryModInt32(Tp val) : m_val{} {
             auto x = val % int32_t(mod());
@@ -48,12 +59,12 @@ namespace OY {
         }
         template <typename Tp, typename std::enable_if<std::is_unsigned<Tp>::value>::type * = nullptr>
         StaticMontgomeryModInt32(Tp val) : m_val{_init(val)} {}
-        static mint _raw(fast_type val) {
+        static constexpr mint _raw(fast_type val) {
             mint res;
             res.m_val = val;
             return res;
         }
-        static mint raw(mod_type val) { return _raw(_raw_init(val)); }
+        static constexpr mint raw(mod_type val) { return _raw(_raw_init(val)); }
         static constexpr mod_type mod() { return P; }
         mod_type val() const { return _reduce(m_val); }
         mint pow(uint64_t n) const {
@@ -128,6 +139,48 @@ namespace OY {
         friend mint operator*(const mint &a, const mint &b) { return mint(a) *= b; }
         friend mint operator/(const mint &a, const mint &b) { return mint(a) /= b; }
     };
+#ifdef __AVX2__
+    template <uint32_t P, bool IsPrime>
+    struct StaticMontgomeryModInt32Vector {
+        using mint = StaticMontgomeryModInt32<P, IsPrime>;
+        using vec = StaticMontgomeryModInt32Vector<P, IsPrime>;
+        using mod_type = uint32_t;
+        static constexpr size_t lanes = 8;
+        __m256i m_val;
+        static __m256i _fix(__m256i x) { return _mm256_min_epu32(x, _mm256_add_epi32(x, _mm256_set1_epi32(P))); }
+        // _mm256_mul_epu32 只取每个 64 位的低 32 位相乘，所以偶数通道直接乘，奇数通道右移 32 位后再乘，最后把两半的高 32 位拼回来
+        static __m256i _reduce_high(__m256i even, __m256i odd) {
+            const __m256i pinv = _mm256_set1_epi32(mint::pinv), mod = _mm256_set1_epi32(P);
+            __m256i q_even = _mm256_mul_epu32(_mm256_mul_epu32(even, pinv), mod), q_odd = _mm256_mul_epu32(_mm256_mul_epu32(odd, pinv), mod);
+            return _mm256_sub_epi32(_mm256_blend_epi32(_mm256_srli_epi64(even, 32), odd, 0b10101010), _mm256_blend_epi32(_mm256_srli_epi64(q_even, 32), q_odd, 0b10101010));
+        }
+        static vec load(const mint *p) { return {_mm256_loadu_si256((const __m256i *)p)}; }
+        static vec broadcast(const mint &x) { return {_mm256_set1_epi32(x.m_val)}; }
+        void store(mint *p) const { _mm256_storeu_si256((__m256i *)p, m_val); }
+        void reduce(mod_type *p) const { _mm256_storeu_si256((__m256i *)p, _fix(_reduce_high(_mm256_blend_epi32(m_val, _mm256_setzero_si256(), 0b10101010), _mm256_srli_epi64(m_val, 32)))); }
+        mint get(size_t i) const {
+            alignas(32) mod_type val[lanes];
+            _mm256_store_si256((__m256i *)val, m_val);
+            return mint::_raw(val[i]);
+        }
+        vec &operator+=(const vec &rhs) {
+            const __m256i x = _mm256_add_epi32(m_val, rhs.m_val);
+            m_val = _mm256_min_epu32(x, _mm256_sub_epi32(x, _mm256_set1_epi32(P)));
+            return *this;
+        }
+        vec &operator-=(const vec &rhs) {
+            m_val = _fix(_mm256_sub_epi32(m_val, rhs.m_val));
+            return *this;
+        }
+        vec &operator*=(const vec &rhs) {
+            m_val = _fix(_reduce_high(_mm256_mul_epu32(m_val, rhs.m_val), _mm256_mul_epu32(_mm256_srli_epi64(m_val, 32), _mm256_srli_epi64(rhs.m_val, 32))));
+            return *this;
+        }
+        friend vec operator+(const vec &a, const vec &b) { return vec(a) += b; }
+        friend vec operator-(const vec &a, const vec &b) { return vec(a) -= b; }
+        friend vec operator*(const vec &a, const vec &b) { return vec(a) *= b; }
+    };
+#endif
     template <typename Istream, uint32_t P, bool IsPrime>
     Istream &operator>>(Istream &is, StaticMontgomeryModInt32<P, IsPrime> &x) {
         uint32_t val;
@@ -1,6 +1,6 @@
 /*
 最后修改:
-20231219
+20261019
 测试环境:
 gcc11.2,c++11
 clang12.0,C++11
@@ -14,11 +14,41 @@ msvc14.2,C++14
 #include <numeric>
 #include <vector>
 
+#include "../TEST/std_prefetch.h"
+
 namespace OY {
     namespace AC {
         using size_type = uint32_t;
         struct Ignore {};
         struct BaseNode {};
+        template <size_type Lanes, typename SequenceIterator, typename Mapping, typename Step, typename Touch, typename Callback>
+        void _batch(SequenceIterator first, SequenceIterator last, Mapping &map, Step &&step, Touch &&touch, Callback &&call) {
+            using iterator = decltype(std::begin(*first));
+            struct lane {
+                size_type m_index, m_state;
+                iterator m_cur, m_end;
+            };
+            lane lanes[Lanes];
+            size_type total = last - first, fed = 0, active = 0;
+            auto feed = [&](lane &l) {
+                while (fed != total) {
+                    auto &seq = *(first + fed);
+                    l = {fed++, 0, std::begin(seq), std::end(seq)};
+                    if (l.m_cur != l.m_end) return true;
+                }
+                return false;
+            };
+            while (active != Lanes && feed(lanes[active])) active++;
+            while (active)
+                for (size_type i = 0; i != active;) {
+                    lane &l = lanes[i];
+                    call(l.m_index, l.m_state = step(l.m_state, map(*l.m_cur)));
+                    if (++l.m_cur != l.m_end || feed(l))
+                        touch(l.m_state, map(*l.m_cur)), i++;
+                    else
+                        l = lanes[--active];
+                }
+        }
         template <typename Node, size_type ChildCount>
         struct Automaton {
             struct node : Node {
@@ -90,6 +120,122 @@ namespace OY {
             const node *get_fail_node(size_type index) const { return get_node(query_fail(index)); }
             node *get_fail_node(size_type index) { return get_node(query_fail(index)); }
             size_type next(size_type last_pos, size_type elem) const { return m_data[last_pos].get_child(elem); }
+            template <size_type Lanes = 8, typename SequenceIterator, typename Mapping, typename Callback>
+            void do_for_each_batch(SequenceIterator first, SequenceIterator last, Mapping &&map, Callback &&call) const {
+                auto step = [&](size_type last_pos, size_type elem) { return next(last_pos, elem); };
+                auto touch = [&](size_type last_pos, size_type elem) { _prefetch(m_data[last_pos].m_child + elem); };
+                _batch<Lanes>(first, last, map, step, touch, call);
+            }
+            template <typename Callback>
+            void do_for_extending_nodes(Callback &&call) const {
+                for (auto &a : m_queue) call(a);
+            }
+            template <typename Callback>
+            void do_for_failing_nodes(Callback &&call) const {
+                for (size_type i = m_queue.size() - 1; ~i; i--) call(m_queue[i]);
+            }
+        };
+        template <typename Node, size_type ChildCount>
+        struct CompactAutomaton {
+            static constexpr size_type max_fail = 16, max_window = ChildCount * 8;
+            struct node : Node {
+                size_type m_base, m_fail;
+            };
+            struct slot {
+                size_type m_check, m_child;
+            };
+            std::vector<node> m_data;
+            std::vector<slot> m_slots;
+            std::vector<size_type> m_queue, m_root, m_first, m_sibling, m_key;
+            size_type m_cursor, m_fail_count;
+            size_type _newnode(size_type key) {
+                m_data.push_back({}), m_first.push_back(0), m_sibling.push_back(0), m_key.push_back(key);
+                return m_data.size() - 1;
+            }
+            size_type _get_or_new(size_type x, size_type c) {
+                for (size_type y = m_first[x]; y; y = m_sibling[y])
+                    if (m_key[y] == c) return y;
+                size_type y = _newnode(c);
+                m_sibling[y] = m_first[x], m_first[x] = y;
+                return y;
+            }
+            bool _empty_slot(size_type pos) const { return pos >= m_slots.size() || !m_slots[pos].m_check; }
+            size_type _find_base(const size_type *keys, size_type cnt) {
+                if (m_cursor + max_window < m_slots.size()) m_cursor = m_slots.size() - max_window, m_fail_count = 0;
+                while (!_empty_slot(m_cursor)) m_cursor++, m_fail_count = 0;
+                for (size_type pos = std::max(m_cursor, keys[0]);; pos++) {
+                    while (!_empty_slot(pos)) pos++;
+                    size_type base = pos - keys[0], i = 1;
+                    while (i != cnt && _empty_slot(base + keys[i])) i++;
+                    if (i == cnt) return base;
+                    if (pos == m_cursor && ++m_fail_count == max_fail)
+                        do m_cursor++, m_fail_count = 0;
+                        while (!_empty_slot(m_cursor));
+                }
+            }
+            void _init() { m_data.clear(), m_slots.clear(), m_queue.clear(), m_root.clear(), m_first.clear(), m_sibling.clear(), m_key.clear(), m_cursor = m_fail_count = 0, _newnode(0); }
+            CompactAutomaton() { _init(); }
+            void reserve(size_type length) { _init(), m_data.reserve(length + 1), m_first.reserve(length + 1), m_sibling.reserve(length + 1), m_key.reserve(length + 1); }
+            void clear() { _init(); }
+            bool empty() const { return m_data.size() == 1; }
+            template <typename Iterator, typename Mapping>
+            size_type insert(Iterator first, Iterator last, Mapping &&map) {
+                size_type x = 0;
+                for (auto it = first; it != last; ++it) x = _get_or_new(x, map(*it));
+                return x;
+            }
+            size_type insert_lower(const std::string &s) {
+                return insert(s.begin(), s.end(), [](char c) { return c - 'a'; });
+            }
+            template <typename ChildCallback = Ignore>
+            void prepare(ChildCallback &&child_call = ChildCallback()) {
+                m_queue.reserve(m_data.size() - 1), m_root.assign(ChildCount, 0);
+                m_slots.reserve(m_data.size() + ChildCount), m_slots.resize(ChildCount);
+                size_type keys[ChildCount], childs[ChildCount], order[ChildCount];
+                for (size_type cursor = 0, cur = 0;; cur = m_queue[cursor++]) {
+                    size_type cnt = 0;
+                    for (size_type y = m_first[cur]; y; y = m_sibling[y]) order[cnt++] = y;
+                    std::sort(order, order + cnt, [&](size_type x, size_type y) { return m_key[x] < m_key[y]; });
+                    for (size_type i = 0; i != cnt; i++) keys[i] = m_key[order[i]], childs[i] = order[i];
+                    if (cnt && cur) {
+                        size_type base = _find_base(keys, cnt);
+                        if (m_slots.size() < base + ChildCount) m_slots.resize(base + ChildCount);
+                        m_data[cur].m_base = base;
+                        for (size_type i = 0; i != cnt; i++) m_slots[base + keys[i]] = {cur + 1, childs[i]};
+                    }
+                    for (size_type i = 0; i != cnt; i++) {
+                        if constexpr (!std::is_same<typename std::decay<ChildCallback>::type, Ignore>::value) child_call(cur, childs[i]);
+                        if (cur)
+                            m_data[childs[i]].m_fail = next(m_data[cur].m_fail, keys[i]);
+                        else
+                            m_root[keys[i]] = childs[i];
+                        m_queue.push_back(childs[i]);
+                    }
+                    if (cursor == m_queue.size()) break;
+                }
+                m_slots.shrink_to_fit();
+                std::vector<size_type>().swap(m_first), std::vector<size_type>().swap(m_sibling), std::vector<size_type>().swap(m_key);
+            }
+            size_type query_fail(size_type index) const { return m_data[index].m_fail; }
+            const node *get_node(size_type index) const { return &m_data[index]; }
+            node *get_node(size_type index) { return &m_data[index]; }
+            const node *get_fail_node(size_type index) const { return get_node(query_fail(index)); }
+            node *get_fail_node(size_type index) { return get_node(query_fail(index)); }
+            size_type next(size_type last_pos, size_type elem) const {
+                for (; last_pos; last_pos = m_data[last_pos].m_fail) {
+                    const slot &s = m_slots[m_data[last_pos].m_base + elem];
+                    if (s.m_check == last_pos + 1) return s.m_child;
+                }
+                return m_root[elem];
+            }
+            template <size_type Lanes = 8, typename SequenceIterator, typename Mapping, typename Callback>
+            void do_for_each_batch(SequenceIterator first, SequenceIterator last, Mapping &&map, Callback &&call) const {
+                auto step = [&](size_type last_pos, size_type elem) { return next(last_pos, elem); };
+                auto touch = [&](size_type last_pos, size_type elem) {
+                    if (last_pos) _prefetch(m_slots.data() + m_data[last_pos].m_base + elem);
+                };
+                _batch<Lanes>(first, last, map, step, touch, call);
+            }
             template <typename Callback>
             void do_for_extending_nodes(Callback &&call) const {
                 for (auto &a : m_queue) call(a);
@@ -102,6 +248,8 @@ namespace OY {
     }
     template <typename Node = AC::BaseNode, AC::size_type ChildCount = 26>
     using ACAM = AC::Automaton<Node, ChildCount>;
+    template <typename Node = AC::BaseNode, AC::size_type ChildCount = 26>
+    using CompactACAM = AC::CompactAutomaton<Node, ChildCount>;
 }
 
 #endif
\ No newline at end of file
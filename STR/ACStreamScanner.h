@@ -0,0 +1,82 @@
+/*
+最后修改:
+20261019
+测试环境:
+gcc11.2,c++11
+clang12.0,C++11
+msvc14.2,C++14
+*/
+#ifndef __OY_ACSTREAMSCANNER__
+#define __OY_ACSTREAMSCANNER__
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+namespace OY {
+    namespace ACSCAN {
+        using size_type = uint32_t;
+        template <typename AC, size_type ThreadNum = 4, size_type BlockSize = 1 << 20>
+        struct Scanner {
+            static_assert(ThreadNum, "ThreadNum Must Be Positive");
+            struct event {
+                uint64_t m_pos;
+                size_type m_node;
+            };
+            const AC *m_ac;
+            size_type m_overlap, m_state;
+            uint64_t m_offset;
+            std::vector<char> m_buffer;
+            std::vector<event> m_events[ThreadNum];
+            template <typename Mapping, typename Judger>
+            size_type _run(const char *window, const char *start, const char *first, const char *last, size_type state, Mapping &map, Judger &judge, std::vector<event> &events) const {
+                events.clear();
+                for (const char *it = start; it != first; ++it) state = m_ac->next(state, map(*it));
+                for (const char *it = first; it != last; ++it)
+                    if (judge(state = m_ac->next(state, map(*it)))) events.push_back({m_offset + (it - window), state});
+                return state;
+            }
+            Scanner(const AC &ac, size_type max_pattern_len) : m_ac(&ac), m_overlap(max_pattern_len ? max_pattern_len - 1 : 0) { reset(); }
+            void reset() { m_state = 0, m_offset = 0; }
+            size_type state() const { return m_state; }
+            uint64_t offset() const { return m_offset; }
+            template <typename Mapping, typename Judger, typename Callback>
+            void scan(const char *first, const char *last, Mapping map, Judger judge, Callback &&call) {
+                while (first != last) {
+                    const char *window_end = size_type(std::min<uint64_t>(last - first, uint64_t(ThreadNum) * BlockSize)) + first;
+                    size_type len = window_end - first, part = (len + ThreadNum - 1) / ThreadNum, state[ThreadNum];
+                    auto work = [&](size_type t) {
+                        const char *from = first + std::min(len, part * t), *to = first + std::min(len, part * (t + 1));
+                        if (from == to) return;
+                        const char *start = size_type(from - first) > m_overlap ? from - m_overlap : first;
+                        state[t] = _run(first, start, from, to, start == first ? m_state : 0, map, judge, m_events[t]);
+                    };
+                    if constexpr (ThreadNum == 1)
+                        work(0);
+                    else {
+                        std::vector<std::thread> threads;
+                        for (size_type t = 1; t != ThreadNum; t++) threads.emplace_back(work, t);
+                        work(0);
+                        for (auto &t : threads) t.join();
+                    }
+                    size_type used = (len + part - 1) / part;
+                    for (size_type t = 0; t != used; t++)
+                        for (auto &e : m_events[t]) call(e.m_pos, e.m_node);
+                    m_state = state[used - 1], m_offset += len, first = window_end;
+                }
+            }
+            template <typename InputHelper, typename Mapping, typename Judger, typename Callback>
+            void scan_stream(InputHelper &in, Mapping map, Judger judge, Callback &&call) {
+                scan(in.m_cursor, in.m_end, map, judge, call), in.m_cursor = in.m_end;
+                m_buffer.resize(uint64_t(ThreadNum) * BlockSize);
+                for (size_type len; (len = fread(m_buffer.data(), 1, m_buffer.size(), in.m_file_ptr));) scan(m_buffer.data(), m_buffer.data() + len, map, judge, call);
+            }
+        };
+    }
+    template <typename AC, ACSCAN::size_type ThreadNum = 4, ACSCAN::size_type BlockSize = 1 << 20>
+    using ACStreamScanner = ACSCAN::Scanner<AC, ThreadNum, BlockSize>;
+}
+
+#endif
@@ -0,0 +1,268 @@
+/*
+最后修改:
+20261019
+测试环境:
+gcc11.2,c++11
+clang12.0,C++11
+msvc14.2,C++14
+*/
+#ifndef __OY_EXTERNALSUFFIXARRAY__
+#define __OY_EXTERNALSUFFIXARRAY__
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <queue>
+#include <string>
+#include <vector>
+
+namespace OY {
+    namespace EXTSA {
+        using size_type = uint64_t;
+        inline void _seek(FILE *fp, size_type offset) {
+#ifdef _MSC_VER
+            _fseeki64(fp, offset, SEEK_SET);
+#else
+            fseeko(fp, offset, SEEK_SET);
+#endif
+        }
+        inline FILE *_open(const std::string &name, const char *mode) {
+            FILE *fp = fopen(name.c_str(), mode);
+            if (!fp) perror(("EXTSA: cannot open " + name).c_str()), std::abort();
+            return fp;
+        }
+        template <typename Tp>
+        struct FileReader {
+            FILE *m_file;
+            std::vector<Tp> m_buf;
+            size_type m_cursor, m_end;
+            FileReader(const std::string &name, size_type buffer_len) : m_file(_open(name, "rb")), m_buf(buffer_len), m_cursor(0), m_end(0) {}
+            FileReader(const FileReader &) = delete;
+            ~FileReader() {
+                if (m_file) fclose(m_file);
+            }
+            bool next(Tp &x) {
+                if (m_cursor == m_end) {
+                    m_cursor = 0, m_end = fread(m_buf.data(), sizeof(Tp), m_buf.size(), m_file);
+                    if (!m_end) return false;
+                }
+                return x = m_buf[m_cursor++], true;
+            }
+        };
+        template <typename Tp>
+        struct FileWriter {
+            FILE *m_file;
+            std::vector<Tp> m_buf;
+            FileWriter(const std::string &name, size_type buffer_len) : m_file(_open(name, "wb")) { m_buf.reserve(buffer_len); }
+            FileWriter(const FileWriter &) = delete;
+            ~FileWriter() {
+                if (m_file) flush(), fclose(m_file);
+            }
+            void flush() {
+                if (fwrite(m_buf.data(), sizeof(Tp), m_buf.size(), m_file) != m_buf.size()) perror("EXTSA: write failed"), std::abort();
+                m_buf.clear();
+            }
+            void push(const Tp &x) {
+                if (m_buf.size() == m_buf.capacity()) flush();
+                m_buf.push_back(x);
+            }
+        };
+        template <typename Tp, typename Compare>
+        void _merge_runs(const std::string *first, const std::string *last, const std::string &output, Compare comp, size_type buffer_len) {
+            std::vector<std::unique_ptr<FileReader<Tp>>> readers;
+            for (auto it = first; it != last; ++it) readers.emplace_back(new FileReader<Tp>(*it, buffer_len));
+            auto heap_comp = [&](const std::pair<Tp, size_type> &x, const std::pair<Tp, size_type> &y) { return comp(y.first, x.first); };
+            std::priority_queue<std::pair<Tp, size_type>, std::vector<std::pair<Tp, size_type>>, decltype(heap_comp)> Q(heap_comp);
+            for (size_type i = 0; i != readers.size(); i++) {
+                Tp x;
+                if (readers[i]->next(x)) Q.emplace(x, i);
+            }
+            FileWriter<Tp> out(output, buffer_len);
+            while (!Q.empty()) {
+                auto top = Q.top();
+                Q.pop(), out.push(top.first);
+                if (readers[top.second]->next(top.first)) Q.push(top);
+            }
+        }
+        template <typename Tp, typename Compare>
+        void external_sort(const std::string &input, const std::string &output, Compare comp, size_type memory_limit, size_type fan_in = 16) {
+            // 切段时读写缓冲各占八分之一的内存限制，其余用于排序段
+            size_type capacity = std::max<size_type>(memory_limit / sizeof(Tp), 1 << 10), io_len = capacity / 8, chunk_len = capacity - io_len * 2;
+            fan_in = std::max<size_type>(fan_in, 2);
+            std::vector<std::string> runs;
+            auto run_name = [&](size_type pass, size_type id) { return output + ".run" + std::to_string(pass) + "_" + std::to_string(id); };
+            {
+                FileReader<Tp> in(input, io_len);
+                std::vector<Tp> chunk;
+                chunk.reserve(chunk_len);
+                for (Tp x; in.next(x);) {
+                    chunk.push_back(x);
+                    if (chunk.size() == chunk_len) {
+                        std::sort(chunk.begin(), chunk.end(), comp), runs.push_back(run_name(0, runs.size()));
+                        FileWriter<Tp> out(runs.back(), io_len);
+                        for (auto &y : chunk) out.push(y);
+                        chunk.clear();
+                    }
+                }
+                if (runs.empty() || chunk.size()) {
+                    std::sort(chunk.begin(), chunk.end(), comp), runs.push_back(run_name(0, runs.size()));
+                    FileWriter<Tp> out(runs.back(), io_len);
+                    for (auto &y : chunk) out.push(y);
+                }
+            }
+            // 每趟最多同时打开 fan_in 个段，逐趟归并直到只剩一段，避免段数过多时超出文件描述符上限
+            size_type buffer_len = std::max<size_type>(capacity / (fan_in + 1), 1 << 10);
+            for (size_type pass = 1; runs.size() > 1; pass++) {
+                std::vector<std::string> next;
+                for (size_type l = 0; l != runs.size();) {
+                    size_type r = std::min<size_type>(l + fan_in, runs.size());
+                    if (r - l == 1)
+                        next.push_back(runs[l]);
+                    else {
+                        next.push_back(run_name(pass, next.size()));
+                        _merge_runs<Tp>(runs.data() + l, runs.data() + r, next.back(), comp, buffer_len);
+                        for (size_type i = l; i != r; i++) remove(runs[i].c_str());
+                    }
+                    l = r;
+                }
+                runs.swap(next);
+            }
+            remove(output.c_str());
+            if (rename(runs[0].c_str(), output.c_str())) perror(("EXTSA: cannot rename " + runs[0]).c_str()), std::abort();
+        }
+        template <bool Height>
+        struct SuffixArray {
+            struct triple {
+                size_type m_name1, m_name2, m_pos;
+            };
+            struct pair {
+                size_type m_pos, m_name;
+            };
+            struct lcp_node {
+                size_type m_rank, m_i, m_j, m_acc, m_name;
+            };
+            struct NameCursor {
+                FileReader<size_type> m_reader;
+                size_type m_length, m_index, m_val;
+                NameCursor(const std::string &name, size_type length, size_type buffer_len) : m_reader(name, buffer_len), m_length(length), m_index(0), m_val(0) {}
+                size_type get(size_type pos) {
+                    if (pos >= m_length) return 0;
+                    while (m_index <= pos) m_reader.next(m_val), m_index++;
+                    return m_val;
+                }
+            };
+            std::string m_prefix;
+            size_type m_length, m_memory_limit;
+            FILE *m_sa_file, *m_height_file;
+            std::string _name_file(size_type round) const { return m_prefix + ".name" + std::to_string(round); }
+            std::string _tmp_file(size_type id) const { return m_prefix + ".tmp" + std::to_string(id); }
+            // 排序之外的每个阶段至多同时打开三个文件流，每个流的缓冲取内存限制的四分之一
+            template <typename Tp>
+            size_type _buffer_len() const { return std::max<size_type>(m_memory_limit / 4 / sizeof(Tp), 1 << 10); }
+            template <typename Tp, typename Compare>
+            void _sort_tmp(Compare comp) { external_sort<Tp>(_tmp_file(0), _tmp_file(1), comp, m_memory_limit), remove(_tmp_file(0).c_str()); }
+            size_type _build_sa(const std::string &text_file) {
+                {
+                    FileReader<uint8_t> in(text_file, _buffer_len<uint8_t>());
+                    FileWriter<size_type> out(_name_file(0), _buffer_len<size_type>());
+                    m_length = 0;
+                    for (uint8_t c; in.next(c); m_length++) out.push(size_type(c) + 1);
+                }
+                for (size_type round = 0;; round++) {
+                    {
+                        FileReader<size_type> cur(_name_file(round), _buffer_len<size_type>()), shift(_name_file(round), _buffer_len<size_type>());
+                        FileWriter<triple> out(_tmp_file(0), _buffer_len<triple>());
+                        size_type name, name2;
+                        for (size_type i = 0; i != size_type(1) << round && shift.next(name2); i++) {}
+                        for (size_type i = 0; cur.next(name); i++) out.push({name, shift.next(name2) ? name2 : 0, i});
+                    }
+                    if constexpr (!Height) remove(_name_file(round).c_str());
+                    _sort_tmp<triple>([](const triple &x, const triple &y) { return x.m_name1 < y.m_name1 || (x.m_name1 == y.m_name1 && x.m_name2 < y.m_name2); });
+                    size_type kind = 0, group = 0;
+                    {
+                        FileReader<triple> in(_tmp_file(1), _buffer_len<triple>());
+                        FileWriter<pair> out(_tmp_file(0), _buffer_len<pair>());
+                        FileWriter<size_type> sa(m_prefix + ".sa", _buffer_len<size_type>());
+                        triple x, prev;
+                        for (size_type i = 0; in.next(x); i++) {
+                            if (!i || x.m_name1 != prev.m_name1 || x.m_name2 != prev.m_name2) kind = i + 1, group++;
+                            out.push({x.m_pos, kind}), sa.push(x.m_pos), prev = x;
+                        }
+                    }
+                    remove(_tmp_file(1).c_str());
+                    if (group == m_length) return remove(_tmp_file(0).c_str()), round + 1;
+                    _sort_tmp<pair>([](const pair &x, const pair &y) { return x.m_pos < y.m_pos; });
+                    {
+                        FileReader<pair> in(_tmp_file(1), _buffer_len<pair>());
+                        FileWriter<size_type> out(_name_file(round + 1), _buffer_len<size_type>());
+                        for (pair x; in.next(x);) out.push(x.m_name);
+                    }
+                    remove(_tmp_file(1).c_str());
+                }
+            }
+            void _build_height(size_type round) {
+                {
+                    FileReader<size_type> sa(m_prefix + ".sa", _buffer_len<size_type>());
+                    FileWriter<lcp_node> out(_tmp_file(0), _buffer_len<lcp_node>());
+                    size_type prev, cur;
+                    if (sa.next(prev))
+                        for (size_type r = 1; sa.next(cur); r++) out.push({r, prev, cur, 0, 0}), prev = cur;
+                }
+                for (size_type t = round - 1; ~t; t--) {
+                    _sort_tmp<lcp_node>([](const lcp_node &x, const lcp_node &y) { return x.m_i + x.m_acc < y.m_i + y.m_acc; });
+                    {
+                        NameCursor names(_name_file(t), m_length, _buffer_len<size_type>());
+                        FileReader<lcp_node> in(_tmp_file(1), _buffer_len<lcp_node>());
+                        FileWriter<lcp_node> out(_tmp_file(0), _buffer_len<lcp_node>());
+                        for (lcp_node x; in.next(x);) x.m_name = names.get(x.m_i + x.m_acc), out.push(x);
+                    }
+                    remove(_tmp_file(1).c_str());
+                    _sort_tmp<lcp_node>([](const lcp_node &x, const lcp_node &y) { return x.m_j + x.m_acc < y.m_j + y.m_acc; });
+                    {
+                        NameCursor names(_name_file(t), m_length, _buffer_len<size_type>());
+                        FileReader<lcp_node> in(_tmp_file(1), _buffer_len<lcp_node>());
+                        FileWriter<lcp_node> out(_tmp_file(0), _buffer_len<lcp_node>());
+                        for (lcp_node x; in.next(x);) {
+                            if (x.m_name && x.m_name == names.get(x.m_j + x.m_acc)) x.m_acc += size_type(1) << t;
+                            out.push(x);
+                        }
+                    }
+                    remove(_tmp_file(1).c_str()), remove(_name_file(t).c_str());
+                }
+                _sort_tmp<lcp_node>([](const lcp_node &x, const lcp_node &y) { return x.m_rank < y.m_rank; });
+                {
+                    FileReader<lcp_node> in(_tmp_file(1), _buffer_len<lcp_node>());
+                    FileWriter<size_type> out(m_prefix + ".height", _buffer_len<size_type>());
+                    if (m_length) out.push(0);
+                    for (lcp_node x; in.next(x);) out.push(x.m_acc);
+                }
+                remove(_tmp_file(1).c_str());
+            }
+            static size_type _read(FILE *fp, size_type index) {
+                size_type res = 0;
+                _seek(fp, index * sizeof(size_type));
+                return fread(&res, sizeof(size_type), 1, fp), res;
+            }
+            SuffixArray(const std::string &text_file, const std::string &output_prefix, size_type memory_limit = size_type(1) << 28) : m_prefix(output_prefix), m_memory_limit(memory_limit), m_height_file(nullptr) {
+                size_type round = _build_sa(text_file);
+                if constexpr (Height) _build_height(round), m_height_file = _open(m_prefix + ".height", "rb");
+                m_sa_file = _open(m_prefix + ".sa", "rb");
+            }
+            SuffixArray(const SuffixArray &) = delete;
+            ~SuffixArray() {
+                if (m_sa_file) fclose(m_sa_file);
+                if (m_height_file) fclose(m_height_file);
+            }
+            size_type size() const { return m_length; }
+            size_type query_sa(size_type rank) const { return _read(m_sa_file, rank); }
+            size_type query_height(size_type rank) const {
+                static_assert(Height, "Height Must Be True");
+                return _read(m_height_file, rank);
+            }
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,100 @@
+/*
+最后修改:
+20261019
+测试环境:
+gcc11.2,c++11
+clang12.0,C++11
+msvc14.2,C++14
+*/
+#ifndef __OY_FMINDEX__
+#define __OY_FMINDEX__
+
+#include <algorithm>
+#include <cstdint>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include "../DS/WaveLet.h"
+
+namespace OY {
+    namespace FM {
+        using size_type = uint32_t;
+        template <size_type SampleRate = 16, size_type MAX_NODE = 1 << 20>
+        struct Index {
+            WaveLet::Table<size_type, uint64_t, MAX_NODE> m_bwt;
+            std::vector<size_type> m_less, m_samples, m_sample_rank;
+            std::vector<uint64_t> m_sampled;
+            size_type m_length, m_alpha;
+            size_type _occ(size_type c, size_type pos) const { return pos ? m_bwt.count(0, pos - 1, c) : 0; }
+            bool _is_sampled(size_type rank) const { return m_sampled[rank >> 6] >> (rank & 63) & 1; }
+            size_type _sample(size_type rank) const { return m_samples[m_sample_rank[rank >> 6] + std::popcount(m_sampled[rank >> 6] & ((uint64_t(1) << (rank & 63)) - 1))]; }
+            template <typename Tp>
+            static size_type _symbol(Tp elem) { return typename std::make_unsigned<Tp>::type(elem); }
+            template <typename Iterator>
+            bool _backward_search(Iterator first, Iterator last, size_type &lo, size_type &hi) const {
+                lo = 0, hi = m_length + 1;
+                for (auto it = last; it != first && lo != hi;) {
+                    size_type sym = _symbol(*--it);
+                    if (sym >= m_alpha - 1) return false;
+                    size_type c = sym + 1;
+                    lo = m_less[c] + _occ(c, lo), hi = m_less[c] + _occ(c, hi);
+                }
+                return lo != hi;
+            }
+            Index() = default;
+            template <typename Iterator, typename SuffixArray>
+            Index(Iterator first, Iterator last, const SuffixArray &sa) { reset(first, last, sa); }
+            template <typename Iterator, typename SuffixArray>
+            void reset(Iterator first, Iterator last, const SuffixArray &sa) {
+                m_length = last - first, m_alpha = 1;
+                for (auto it = first; it != last; ++it) m_alpha = std::max<size_type>(m_alpha, _symbol(*it) + 2);
+                m_less.assign(m_alpha + 1, 0);
+                m_less[1] = 1;
+                for (auto it = first; it != last; ++it) m_less[_symbol(*it) + 2]++;
+                std::partial_sum(m_less.begin(), m_less.end(), m_less.begin());
+                auto sa_at = [&](size_type rank) { return rank ? size_type(sa.query_sa(rank - 1)) : m_length; };
+                m_bwt.resize(
+                    m_length + 1, [&](size_type rank) {
+                        size_type pos = sa_at(rank);
+                        return pos ? _symbol(*(first + (pos - 1))) + 1 : 0;
+                    },
+                    std::bit_width(m_alpha - 1));
+                m_sampled.assign((m_length >> 6) + 1, 0), m_sample_rank.resize(m_sampled.size()), m_samples.clear(), m_samples.reserve(m_length / SampleRate + 1);
+                for (size_type rank = 0; rank != m_length + 1; rank++) {
+                    size_type pos = sa_at(rank);
+                    if (pos % SampleRate == 0) m_sampled[rank >> 6] |= uint64_t(1) << (rank & 63), m_samples.push_back(pos);
+                }
+                for (size_type i = 0, cur = 0; i != m_sampled.size(); i++) m_sample_rank[i] = cur, cur += std::popcount(m_sampled[i]);
+            }
+            size_type size() const { return m_length; }
+            template <typename Iterator>
+            size_type count(Iterator first, Iterator last) const {
+                size_type lo, hi;
+                return _backward_search(first, last, lo, hi) ? hi - lo : 0;
+            }
+            template <typename Sequence>
+            size_type count(const Sequence &pattern) const { return count(pattern.begin(), pattern.end()); }
+            size_type locate_rank(size_type rank) const {
+                size_type step = 0;
+                while (!_is_sampled(rank)) {
+                    size_type c = m_bwt.quantile(rank, rank, 0);
+                    rank = m_less[c] + _occ(c, rank), step++;
+                }
+                return _sample(rank) + step;
+            }
+            template <typename Iterator, typename Callback>
+            void do_for_each_occurrence(Iterator first, Iterator last, Callback &&call) const {
+                size_type lo, hi;
+                if (_backward_search(first, last, lo, hi))
+                    for (size_type rank = lo; rank != hi; rank++) call(locate_rank(rank));
+            }
+            template <typename Sequence, typename Callback>
+            void do_for_each_occurrence(const Sequence &pattern, Callback &&call) const { do_for_each_occurrence(pattern.begin(), pattern.end(), call); }
+        };
+    }
+    template <FM::size_type SampleRate = 16, FM::size_type MAX_NODE = 1 << 20>
+    using FMIndex = FM::Index<SampleRate, MAX_NODE>;
+}
+
+#endif
@@ -1,6 +1,6 @@
 /*
 最后修改:
-20231219
+20261019
 测试环境:
 gcc11.2,c++11
 clang12.0,C++11
@@ -15,6 +15,9 @@ msvc14.2,C++14
 #include <numeric>
 #include <vector>
 
+#include "../TEST/std_bit.h"
+#include "../TEST/std_prefetch.h"
+
 namespace OY {
     namespace SAM {
         using size_type = uint32_t;
@@ -27,6 +30,179 @@ namespace OY {
             size_type get_child(size_type index) const { return m_child[index]; }
             void copy_children(const StaticNode<Node, ChildCount> &rhs) { std::copy_n(rhs.m_child, ChildCount, m_child); }
         };
+        template <typename Node, size_type MAX_EDGE>
+        struct SortedNode : Node {
+            static size_type s_key[MAX_EDGE], s_child[MAX_EDGE], s_free[32], s_use_count;
+            size_type m_offset, m_size;
+            static size_type _alloc(size_type k) {
+                if (!s_free[k]) return (s_use_count += size_type(1) << k) - (size_type(1) << k);
+                size_type res = s_free[k] - 1;
+                return s_free[k] = s_child[res], res;
+            }
+            static void _release(size_type offset, size_type k) { s_child[offset] = s_free[k], s_free[k] = offset + 1; }
+            size_type _find(size_type index) const {
+                const size_type *first = s_key + m_offset;
+                if (m_size > 8) return std::lower_bound(first, first + m_size, index) - first;
+                size_type i = 0;
+                while (i != m_size && first[i] < index) i++;
+                return i;
+            }
+            bool has_child(size_type index) const {
+                size_type i = _find(index);
+                return i != m_size && s_key[m_offset + i] == index;
+            }
+            void set_child(size_type index, size_type child) {
+                size_type i = _find(index);
+                if (i != m_size && s_key[m_offset + i] == index) {
+                    s_child[m_offset + i] = child;
+                    return;
+                }
+                if (!(m_size & (m_size - 1))) {
+                    size_type k = std::bit_width(m_size), offset = _alloc(k);
+                    std::copy_n(s_key + m_offset, i, s_key + offset), std::copy_n(s_child + m_offset, i, s_child + offset);
+                    std::copy_n(s_key + m_offset + i, m_size - i, s_key + offset + i + 1), std::copy_n(s_child + m_offset + i, m_size - i, s_child + offset + i + 1);
+                    if (m_size) _release(m_offset, k - 1);
+                    m_offset = offset;
+                } else
+                    std::copy_backward(s_key + m_offset + i, s_key + m_offset + m_size, s_key + m_offset + m_size + 1), std::copy_backward(s_child + m_offset + i, s_child + m_offset + m_size, s_child + m_offset + m_size + 1);
+                s_key[m_offset + i] = index, s_child[m_offset + i] = child, m_size++;
+            }
+            size_type get_child(size_type index) const { return s_child[m_offset + _find(index)]; }
+            void copy_children(const SortedNode<Node, MAX_EDGE> &rhs) {
+                if (!(m_size = rhs.m_size)) return;
+                m_offset = _alloc(std::bit_width(m_size - 1));
+                std::copy_n(s_key + rhs.m_offset, m_size, s_key + m_offset), std::copy_n(s_child + rhs.m_offset, m_size, s_child + m_offset);
+            }
+        };
+        template <typename Node, size_type MAX_EDGE>
+        size_type SortedNode<Node, MAX_EDGE>::s_key[MAX_EDGE];
+        template <typename Node, size_type MAX_EDGE>
+        size_type SortedNode<Node, MAX_EDGE>::s_child[MAX_EDGE];
+        template <typename Node, size_type MAX_EDGE>
+        size_type SortedNode<Node, MAX_EDGE>::s_free[32];
+        template <typename Node, size_type MAX_EDGE>
+        size_type SortedNode<Node, MAX_EDGE>::s_use_count;
+        template <typename Node, size_type MAX_EDGE>
+        struct HashNode : Node {
+            static size_type s_key[MAX_EDGE], s_child[MAX_EDGE], s_free[32], s_use_count;
+            size_type m_offset, m_size;
+            static size_type _alloc(size_type k) {
+                size_type res;
+                if (!s_free[k])
+                    res = s_use_count, s_use_count += size_type(1) << k;
+                else
+                    res = s_free[k] - 1, s_free[k] = s_child[res];
+                std::fill_n(s_key + res, size_type(1) << k, -1);
+                return res;
+            }
+            static void _release(size_type offset, size_type k) { s_child[offset] = s_free[k], s_free[k] = offset + 1; }
+            static size_type _slot(size_type offset, size_type k, size_type index) {
+                size_type mask = (size_type(1) << k) - 1, i = (index * size_type(0x9e3779b9)) >> (32 - k);
+                while (~s_key[offset + i] && s_key[offset + i] != index) i = (i + 1) & mask;
+                return offset + i;
+            }
+            size_type _log() const { return std::bit_width(m_size - 1) + 1; }
+            bool has_child(size_type index) const { return m_size && s_key[_slot(m_offset, _log(), index)] == index; }
+            void set_child(size_type index, size_type child) {
+                if (m_size) {
+                    size_type slot = _slot(m_offset, _log(), index);
+                    if (s_key[slot] == index) {
+                        s_child[slot] = child;
+                        return;
+                    }
+                }
+                if (!(m_size & (m_size - 1))) {
+                    size_type k = std::bit_width(m_size) + 1, offset = _alloc(k);
+                    if (m_size) {
+                        size_type old = _log();
+                        for (size_type i = m_offset, end = m_offset + (size_type(1) << old); i != end; i++)
+                            if (~s_key[i]) {
+                                size_type slot = _slot(offset, k, s_key[i]);
+                                s_key[slot] = s_key[i], s_child[slot] = s_child[i];
+                            }
+                        _release(m_offset, old);
+                    }
+                    m_offset = offset;
+                }
+                m_size++;
+                size_type slot = _slot(m_offset, _log(), index);
+                s_key[slot] = index, s_child[slot] = child;
+            }
+            size_type get_child(size_type index) const { return s_child[_slot(m_offset, _log(), index)]; }
+            void copy_children(const HashNode<Node, MAX_EDGE> &rhs) {
+                if (!(m_size = rhs.m_size)) return;
+                size_type k = _log();
+                m_offset = _alloc(k);
+                std::copy_n(s_key + rhs.m_offset, size_type(1) << k, s_key + m_offset), std::copy_n(s_child + rhs.m_offset, size_type(1) << k, s_child + m_offset);
+            }
+        };
+        template <typename Node, size_type MAX_EDGE>
+        size_type HashNode<Node, MAX_EDGE>::s_key[MAX_EDGE];
+        template <typename Node, size_type MAX_EDGE>
+        size_type HashNode<Node, MAX_EDGE>::s_child[MAX_EDGE];
+        template <typename Node, size_type MAX_EDGE>
+        size_type HashNode<Node, MAX_EDGE>::s_free[32];
+        template <typename Node, size_type MAX_EDGE>
+        size_type HashNode<Node, MAX_EDGE>::s_use_count;
+        template <typename Node, size_type ChildCount, size_type MAX_SLOT>
+        struct DoubleArrayNode : Node {
+            static constexpr size_type max_fail = 16, max_window = ChildCount * 8;
+            static size_type s_next[MAX_SLOT], s_check[MAX_SLOT], s_tag_count, s_cursor, s_fail, s_use_count;
+            size_type m_base, m_tag;
+            static size_type _find_base(const size_type *keys, size_type cnt) {
+                if (s_cursor + max_window < s_use_count) s_cursor = s_use_count - max_window, s_fail = 0;
+                while (s_check[s_cursor]) s_cursor++, s_fail = 0;
+                for (size_type pos = std::max(s_cursor, keys[0]);; pos++) {
+                    while (s_check[pos]) pos++;
+                    size_type base = pos - keys[0], i = 1;
+                    while (i != cnt && !s_check[base + keys[i]]) i++;
+                    if (i == cnt) return s_use_count = std::max(s_use_count, base + keys[cnt - 1] + 1), base;
+                    if (pos == s_cursor && ++s_fail == max_fail)
+                        do s_cursor++, s_fail = 0;
+                        while (s_check[s_cursor]);
+                }
+            }
+            size_type _collect(size_type *keys) const {
+                size_type cnt = 0;
+                if (m_tag)
+                    for (size_type i = 0; i != ChildCount; i++)
+                        if (s_check[m_base + i] == m_tag) keys[cnt++] = i;
+                return cnt;
+            }
+            bool has_child(size_type index) const { return m_tag && s_check[m_base + index] == m_tag; }
+            void set_child(size_type index, size_type child) {
+                if (!m_tag)
+                    m_tag = ++s_tag_count, m_base = _find_base(&index, 1);
+                else if (s_check[m_base + index] && s_check[m_base + index] != m_tag) {
+                    size_type keys[ChildCount + 1], cnt = _collect(keys);
+                    keys[cnt++] = index, std::sort(keys, keys + cnt);
+                    size_type base = _find_base(keys, cnt);
+                    for (size_type i = 0; i != cnt; i++)
+                        if (keys[i] != index) s_next[base + keys[i]] = s_next[m_base + keys[i]], s_check[base + keys[i]] = m_tag, s_check[m_base + keys[i]] = 0;
+                    m_base = base;
+                }
+                s_check[m_base + index] = m_tag, s_next[m_base + index] = child;
+            }
+            size_type get_child(size_type index) const { return s_next[m_base + index]; }
+            void copy_children(const DoubleArrayNode<Node, ChildCount, MAX_SLOT> &rhs) {
+                size_type keys[ChildCount], cnt = rhs._collect(keys);
+                if (!cnt) return;
+                m_tag = ++s_tag_count, m_base = _find_base(keys, cnt);
+                for (size_type i = 0; i != cnt; i++) s_next[m_base + keys[i]] = s_next[rhs.m_base + keys[i]], s_check[m_base + keys[i]] = m_tag;
+            }
+        };
+        template <typename Node, size_type ChildCount, size_type MAX_SLOT>
+        size_type DoubleArrayNode<Node, ChildCount, MAX_SLOT>::s_next[MAX_SLOT];
+        template <typename Node, size_type ChildCount, size_type MAX_SLOT>
+        size_type DoubleArrayNode<Node, ChildCount, MAX_SLOT>::s_check[MAX_SLOT];
+        template <typename Node, size_type ChildCount, size_type MAX_SLOT>
+        size_type DoubleArrayNode<Node, ChildCount, MAX_SLOT>::s_tag_count;
+        template <typename Node, size_type ChildCount, size_type MAX_SLOT>
+        size_type DoubleArrayNode<Node, ChildCount, MAX_SLOT>::s_cursor;
+        template <typename Node, size_type ChildCount, size_type MAX_SLOT>
+        size_type DoubleArrayNode<Node, ChildCount, MAX_SLOT>::s_fail;
+        template <typename Node, size_type ChildCount, size_type MAX_SLOT>
+        size_type DoubleArrayNode<Node, ChildCount, MAX_SLOT>::s_use_count;
         template <typename Node>
         struct Automaton {
             struct node : Node {
@@ -89,6 +265,39 @@ namespace OY {
                 m_queue.resize(m_data.size());
                 for (size_type i = 0; i != m_data.size(); i++) m_queue[--cnt[m_data[i].m_length]] = i;
             }
+            template <size_type Lanes = 8, typename SequenceIterator, typename Mapping, typename Callback>
+            void query_batch(SequenceIterator first, SequenceIterator last, Mapping &&map, Callback &&call) const {
+                using iterator = decltype(std::begin(*first));
+                struct lane {
+                    size_type m_index, m_state;
+                    iterator m_cur, m_end;
+                };
+                lane lanes[Lanes];
+                size_type total = last - first, fed = 0, active = 0;
+                auto feed = [&](lane &l) {
+                    while (fed != total) {
+                        auto &seq = *(first + fed);
+                        l = {fed++, 0, std::begin(seq), std::end(seq)};
+                        if (l.m_cur != l.m_end) return true;
+                        call(l.m_index, 0);
+                    }
+                    return false;
+                };
+                while (active != Lanes && feed(lanes[active])) active++;
+                while (active)
+                    for (size_type i = 0; i != active;) {
+                        lane &l = lanes[i];
+                        auto c = map(*l.m_cur);
+                        const node &x = m_data[l.m_state];
+                        l.m_state = x.has_child(c) ? x.get_child(c) : -1;
+                        if (~l.m_state && ++l.m_cur != l.m_end)
+                            _prefetch(&m_data[l.m_state]), i++;
+                        else if (call(l.m_index, l.m_state), feed(l))
+                            i++;
+                        else
+                            l = lanes[--active];
+                    }
+            }
             size_type query_node_index(size_type i) const { return m_node[i + 1]; }
             size_type query_fail(size_type node_index) const { return m_data[node_index].m_fail; }
             const node *get_node(size_type node_index) const { return &m_data[node_index]; }
@@ -107,6 +316,12 @@ namespace OY {
     }
     template <typename Node = SAM::BaseNode, SAM::size_type ChildCount = 26>
     using StaticSAM_string = SAM::Automaton<SAM::StaticNode<Node, ChildCount>>;
+    template <typename Node = SAM::BaseNode, SAM::size_type MAX_EDGE = 1 << 22>
+    using SortedSAM = SAM::Automaton<SAM::SortedNode<Node, MAX_EDGE>>;
+    template <typename Node = SAM::BaseNode, SAM::size_type MAX_EDGE = 1 << 22>
+    using HashSAM = SAM::Automaton<SAM::HashNode<Node, MAX_EDGE>>;
+    template <typename Node = SAM::BaseNode, SAM::size_type ChildCount = 26, SAM::size_type MAX_SLOT = 1 << 22>
+    using DoubleArraySAM = SAM::Automaton<SAM::DoubleArrayNode<Node, ChildCount, MAX_SLOT>>;
 }
 
 #endif
\ No newline at end of file
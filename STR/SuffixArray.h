@@ -1,6 +1,6 @@
 /*
 最后修改:
-20231218
+20261019
 测试环境:
 gcc11.2,c++11
 clang12.0,C++11
@@ -12,17 +12,160 @@ msvc14.2,C++14
 #include <algorithm>
 #include <cstdint>
 #include <numeric>
+#include <thread>
 #include <vector>
 
 namespace OY {
     namespace SA {
         using size_type = uint32_t;
-        template <bool Rank, bool Height, size_type MAX_LEN>
+        template <size_type ThreadNum, typename Callback>
+        void _parallel_do(size_type length, Callback &&call) {
+            if constexpr (ThreadNum == 1)
+                call(0, length);
+            else {
+                std::vector<std::thread> threads;
+                size_type block = (length + ThreadNum - 1) / ThreadNum;
+                for (size_type i = 0; i < length; i += block) threads.emplace_back(call, i, std::min(length, i + block));
+                for (auto &t : threads) t.join();
+            }
+        }
+        struct PointerGetter {
+            const size_type *m_ptr;
+            size_type operator()(size_type i) const { return m_ptr[i]; }
+        };
+        template <bool Rank, bool Height, size_type MAX_LEN, size_type ThreadNum = 1>
         struct SuffixArray {
+            static constexpr size_type buffer_len = MAX_LEN ? MAX_LEN : 1;
             size_type m_length;
             std::vector<size_type> m_sa, m_rank, m_height;
-            static bool s_bool_buffer[MAX_LEN << 1];
-            static size_type s_lms_map_buffer[MAX_LEN * 3], s_buffer[MAX_LEN * 5];
+            static constexpr size_type induce_block = 1 << 18;
+            static bool s_bool_buffer[buffer_len << 1];
+            static size_type s_lms_map_buffer[buffer_len * 3], s_buffer[buffer_len * 5];
+            template <bool Forward, typename SA, typename Prepare, typename Apply>
+            static void _induce_pass(SA sa, size_type length, Prepare &&prepare, Apply &&apply) {
+                if constexpr (ThreadNum == 1) {
+                    if constexpr (Forward)
+                        for (size_type i = 0; i != length; i++) apply(sa[i], prepare(sa[i]));
+                    else
+                        for (size_type i = length - 1; ~i; i--) apply(sa[i], prepare(sa[i]));
+                } else {
+                    // 写入依赖之前的写入，只能顺序进行；但是读取 sa[i] - 1 处的字符和类型是随机访存，占了大部分时间
+                    // 所以每个块先并行地预读，再顺序写入；写入时若发现某位置在预读之后又被改写，就重新计算
+                    std::vector<size_type> val(std::min(length, induce_block)), code(val.size());
+                    for (size_type done = 0; done < length; done += induce_block) {
+                        const size_type len = std::min(induce_block, length - done), first = Forward ? done : length - done - len;
+                        _parallel_do<ThreadNum>(len, [&](size_type l, size_type r) {
+                            for (size_type k = l; k != r; k++) val[k] = sa[first + k], code[k] = prepare(val[k]);
+                        });
+                        if constexpr (Forward)
+                            for (size_type k = 0; k != len; k++) {
+                                const size_type v = sa[first + k];
+                                apply(v, v == val[k] ? code[k] : prepare(v));
+                            }
+                        else
+                            for (size_type k = len - 1; ~k; k--) {
+                                const size_type v = sa[first + k];
+                                apply(v, v == val[k] ? code[k] : prepare(v));
+                            }
+                    }
+                }
+            }
+            template <typename Getter>
+            static void _get_buckets(Getter chr, size_type length, size_type *bucket, size_type alpha, bool end) {
+                std::fill_n(bucket, alpha, 0);
+                if constexpr (ThreadNum != 1 && !std::is_same<Getter, PointerGetter>::value) {
+                    std::vector<size_type> local(alpha * ThreadNum);
+                    size_type block = (length + ThreadNum - 1) / ThreadNum;
+                    _parallel_do<ThreadNum>(length, [&](size_type first, size_type last) {
+                        size_type *cnt = local.data() + first / block * alpha;
+                        for (size_type i = first; i != last; i++) cnt[chr(i)]++;
+                    });
+                    for (size_type t = 0; t != ThreadNum; t++)
+                        for (size_type i = 0; i != alpha; i++) bucket[i] += local[t * alpha + i];
+                } else
+                    for (size_type i = 0; i != length; i++) bucket[chr(i)]++;
+                for (size_type i = 0, sum = 0; i != alpha; i++) sum += bucket[i], bucket[i] = end ? sum : sum - bucket[i];
+            }
+            template <typename Getter>
+            static void _sa_is_lean(Getter chr, size_type *sa, size_type length, size_type alpha) {
+                if (length == 1) {
+                    sa[0] = 0;
+                    return;
+                }
+                std::vector<uint64_t> ls((length >> 6) + 1);
+                auto get_ls = [&](size_type i) -> bool { return ls[i >> 6] >> (i & 63) & 1; };
+                auto is_lms = [&](size_type i) { return i && get_ls(i) && !get_ls(i - 1); };
+                ls[(length - 1) >> 6] |= uint64_t(1) << ((length - 1) & 63);
+                for (size_type i = length - 2, cur = chr(length - 1), nxt; ~i; i--) {
+                    nxt = cur, cur = chr(i);
+                    if (cur < nxt || (cur == nxt && get_ls(i + 1))) ls[i >> 6] |= uint64_t(1) << (i & 63);
+                }
+                std::vector<size_type> bucket(alpha);
+                auto induce = [&] {
+                    _get_buckets(chr, length, bucket.data(), alpha, false);
+                    _induce_pass<true>(
+                        sa, length, [&](size_type v) -> size_type { return v && ~v && !get_ls(v - 1) ? chr(v - 1) : alpha; },
+                        [&](size_type v, size_type c) {
+                            if (c != alpha) sa[bucket[c]++] = v - 1;
+                        });
+                    _get_buckets(chr, length, bucket.data(), alpha, true);
+                    _induce_pass<false>(
+                        sa, length, [&](size_type v) -> size_type { return v && ~v && get_ls(v - 1) ? chr(v - 1) : alpha; },
+                        [&](size_type v, size_type c) {
+                            if (c != alpha) sa[--bucket[c]] = v - 1;
+                        });
+                };
+                _get_buckets(chr, length, bucket.data(), alpha, true);
+                std::fill_n(sa, length, -1);
+                for (size_type i = 1; i != length; i++)
+                    if (is_lms(i)) sa[--bucket[chr(i)]] = i;
+                induce();
+                size_type m = 0, rec_alpha = 0;
+                for (size_type i = 0; i != length; i++)
+                    if (is_lms(sa[i])) sa[m++] = sa[i];
+                std::fill(sa + m, sa + length, -1);
+                for (size_type i = 0, prev = -1; i != m; i++) {
+                    size_type cur = sa[i];
+                    bool diff = !~prev;
+                    for (size_type d = 0; !diff; d++)
+                        if (chr(cur + d) != chr(prev + d) || get_ls(cur + d) != get_ls(prev + d))
+                            diff = true;
+                        else if (d && (is_lms(cur + d) || is_lms(prev + d)))
+                            break;
+                    if (diff) rec_alpha++, prev = cur;
+                    sa[m + (cur >> 1)] = rec_alpha - 1;
+                }
+                for (size_type i = length - 1, j = length - 1; i >= m; i--)
+                    if (~sa[i]) sa[j--] = sa[i];
+                size_type *rec_sa = sa, *rec_s = sa + length - m;
+                if (rec_alpha < m) {
+                    std::vector<size_type>().swap(bucket);
+                    _sa_is_lean(PointerGetter{rec_s}, rec_sa, m, rec_alpha);
+                    bucket.resize(alpha);
+                } else
+                    for (size_type i = 0; i != m; i++) rec_sa[rec_s[i]] = i;
+                for (size_type i = 1, j = 0; i != length; i++)
+                    if (is_lms(i)) rec_s[j++] = i;
+                for (size_type i = 0; i != m; i++) rec_sa[i] = rec_s[rec_sa[i]];
+                std::fill(sa + m, sa + length, -1);
+                _get_buckets(chr, length, bucket.data(), alpha, true);
+                for (size_type i = m - 1; ~i; i--) {
+                    size_type j = sa[i];
+                    sa[i] = -1, sa[--bucket[chr(j)]] = j;
+                }
+                induce();
+            }
+            template <typename Sequence>
+            void _build(const Sequence &seq, size_type alpha) {
+                if constexpr (MAX_LEN != 0)
+                    m_sa.resize(m_length), _sa_is(seq, m_length, alpha, s_bool_buffer, s_buffer);
+                else {
+                    m_sa.resize(m_length + 1);
+                    _sa_is_lean([&](size_type i) { return i == m_length ? 0 : size_type(seq[i]) + 1; }, m_sa.data(), m_length + 1, alpha + 1);
+                    m_sa.erase(m_sa.begin());
+                }
+            }
+            bool _fit(size_type Mx) const { return MAX_LEN ? Mx < MAX_LEN : Mx <= m_length; }
             template <typename Sequence>
             void _sa_is(const Sequence &seq, size_type length, size_type alpha, bool *ls, size_type *buffer) {
                 if (length == 1) {
@@ -60,15 +203,17 @@ namespace OY {
                     }
                     std::copy_n(sum_l, alpha, buf);
                     m_sa[buf[seq[length - 1]]++] = length - 1;
-                    for (size_type i = 0; i != length; i++) {
-                        typename std::make_signed<size_type>::type v = m_sa[i];
-                        if (v >= 1 && !ls[v - 1]) m_sa[buf[seq[v - 1]]++] = v - 1;
-                    }
+                    _induce_pass<true>(
+                        m_sa.data(), length, [&](size_type v) -> size_type { return typename std::make_signed<size_type>::type(v) >= 1 && !ls[v - 1] ? size_type(seq[v - 1]) : alpha; },
+                        [&](size_type v, size_type c) {
+                            if (c != alpha) m_sa[buf[c]++] = v - 1;
+                        });
                     std::copy_n(sum_l, alpha, buf);
-                    for (size_type i = length - 1; ~i; i--) {
-                        typename std::make_signed<size_type>::type v = m_sa[i];
-                        if (v >= 1 && ls[v - 1]) m_sa[--buf[seq[v - 1] + 1]] = v - 1;
-                    }
+                    _induce_pass<false>(
+                        m_sa.data(), length, [&](size_type v) -> size_type { return typename std::make_signed<size_type>::type(v) >= 1 && ls[v - 1] ? size_type(seq[v - 1]) : alpha; },
+                        [&](size_type v, size_type c) {
+                            if (c != alpha) m_sa[--buf[c + 1]] = v - 1;
+                        });
                 };
                 size_type *lms_map = s_lms_map_buffer, *lms = buffer + alpha * 3, *lms_end = lms;
                 lms_map[0] = lms_map[length] = -1;
@@ -104,17 +249,21 @@ namespace OY {
             }
             void _get_rank() {
                 m_rank.resize(m_length);
-                for (size_type i = 0; i != m_length; i++) m_rank[m_sa[i]] = i;
+                _parallel_do<ThreadNum>(m_length, [&](size_type first, size_type last) {
+                    for (size_type i = first; i != last; i++) m_rank[m_sa[i]] = i;
+                });
             }
             template <typename Sequence>
             void _get_height(const Sequence &seq) {
                 m_height.resize(m_length);
-                for (size_type i = 0, h = 0; i != m_length; i++) {
-                    if (h) h--;
-                    if (m_rank[i])
-                        while (m_sa[m_rank[i] - 1] + h < m_length && seq[i + h] == seq[m_sa[m_rank[i] - 1] + h]) h++;
-                    m_height[m_rank[i]] = h;
-                }
+                _parallel_do<ThreadNum>(m_length, [&](size_type first, size_type last) {
+                    for (size_type i = first, h = 0; i != last; i++) {
+                        if (h) h--;
+                        if (m_rank[i])
+                            while (m_sa[m_rank[i] - 1] + h < m_length && seq[i + h] == seq[m_sa[m_rank[i] - 1] + h]) h++;
+                        m_height[m_rank[i]] = h;
+                    }
+                });
             }
             SuffixArray() = default;
             template <typename InitMapping>
@@ -136,16 +285,15 @@ namespace OY {
                     less_than_zero |= elem < 0;
                     text.push_back(elem);
                 }
-                m_sa.resize(m_length);
-                if (Mx < MAX_LEN && !less_than_zero)
-                    _sa_is(text, m_length, Mx + 1, s_bool_buffer, s_buffer);
+                if (_fit(Mx) && !less_than_zero)
+                    _build(text, Mx + 1);
                 else {
                     std::vector<value_type> items(text);
                     std::sort(items.begin(), items.end());
                     items.erase(std::unique(items.begin(), items.end()), items.end());
                     std::vector<size_type> ord(m_length);
                     for (size_type i = 0; i != m_length; i++) ord[i] = std::lower_bound(items.begin(), items.end(), text[i]) - items.begin();
-                    _sa_is(ord, m_length, items.size(), s_bool_buffer, s_buffer);
+                    _build(ord, items.size());
                 }
                 if constexpr (Rank) {
                     _get_rank();
@@ -157,7 +305,7 @@ namespace OY {
                 using value_type = typename std::decay<decltype(*first)>::type;
                 m_length = last - first;
                 if (alpha)
-                    _sa_is(first, m_length, alpha, s_bool_buffer, s_buffer);
+                    _build(first, alpha);
                 else {
                     size_type Mx = 0;
                     bool less_than_zero = false;
@@ -166,16 +314,15 @@ namespace OY {
                         Mx = std::max<size_type>(Mx, elem);
                         less_than_zero |= elem < 0;
                     }
-                    m_sa.resize(m_length);
-                    if (Mx < MAX_LEN && !less_than_zero)
-                        _sa_is(first, m_length, Mx + 1, s_bool_buffer, s_buffer);
+                    if (_fit(Mx) && !less_than_zero)
+                        _build(first, Mx + 1);
                     else {
                         std::vector<value_type> items(first, last);
                         std::sort(items.begin(), items.end());
                         items.erase(std::unique(items.begin(), items.end()), items.end());
                         std::vector<size_type> ord(m_length);
                         for (size_type i = 0; i != m_length; i++) ord[i] = std::lower_bound(items.begin(), items.end(), *(first + i)) - items.begin();
-                        _sa_is(ord, m_length, items.size(), s_bool_buffer, s_buffer);
+                        _build(ord, items.size());
                     }
                 }
                 if constexpr (Rank) {
@@ -193,12 +340,12 @@ namespace OY {
                 return m_height[rank];
             }
         };
-        template <bool Rank, bool Height, size_type MAX_LEN>
-        bool SuffixArray<Rank, Height, MAX_LEN>::s_bool_buffer[MAX_LEN << 1];
-        template <bool Rank, bool Height, size_type MAX_LEN>
-        size_type SuffixArray<Rank, Height, MAX_LEN>::s_lms_map_buffer[MAX_LEN * 3];
-        template <bool Rank, bool Height, size_type MAX_LEN>
-        size_type SuffixArray<Rank, Height, MAX_LEN>::s_buffer[MAX_LEN * 5];
+        template <bool Rank, bool Height, size_type MAX_LEN, size_type ThreadNum>
+        bool SuffixArray<Rank, Height, MAX_LEN, ThreadNum>::s_bool_buffer[buffer_len << 1];
+        template <bool Rank, bool Height, size_type MAX_LEN, size_type ThreadNum>
+        size_type SuffixArray<Rank, Height, MAX_LEN, ThreadNum>::s_lms_map_buffer[buffer_len * 3];
+        template <bool Rank, bool Height, size_type MAX_LEN, size_type ThreadNum>
+        size_type SuffixArray<Rank, Height, MAX_LEN, ThreadNum>::s_buffer[buffer_len * 5];
     }
 }
 
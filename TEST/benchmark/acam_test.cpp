@@ -0,0 +1,56 @@
+/*
+本文件在 C++20 标准下编译运行，比较 AC 自动机普通版本与紧凑版本在字节字符集下的内存占用与匹配速度
+*/
+#include <chrono>
+#include <random>
+
+#include "IO/FastIO.h"
+#include "STR/ACAutomaton.h"
+
+static constexpr uint32_t P = 50000, L = 10, N = 50000000;
+std::vector<std::string> patterns;
+std::string text;
+std::mt19937_64 rr;
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+template <typename AC>
+void test(const char *name, uint64_t (*memory)(const AC &)) {
+    AC ac;
+    timer_start;
+    for (auto &s : patterns) ac.insert(s.begin(), s.end(), [](char c) { return uint8_t(c); });
+    ac.prepare();
+    timer_end;
+    auto build = duration_get;
+    uint64_t sum = 0;
+    timer_start;
+    uint32_t pos = 0;
+    for (char c : text) sum += pos = ac.next(pos, uint8_t(c));
+    timer_end;
+    cout << name << ": nodes = " << ac.m_data.size() << ", memory = " << memory(ac) / (1 << 20) << " MB, build = " << build << " ms, scan = " << duration_get << " ms, checksum = " << sum << endl;
+}
+int main() {
+    // 模式串和文本都只用前 16 个字节，使得匹配时能够频繁地走入深层结点
+    for (uint32_t i = 0; i != P; i++) {
+        patterns.emplace_back(L, 0);
+        for (auto &c : patterns.back()) c = rr() % 16;
+    }
+    text.resize(N);
+    for (uint32_t i = 0; i != N; i += L)
+        if (rr() % 4)
+            std::copy_n(patterns[rr() % P].begin(), std::min(L, N - i), text.begin() + i);
+        else
+            for (uint32_t j = i; j != std::min(i + L, N); j++) text[j] = rr() % 16;
+    using namespace OY::AC;
+    test<Automaton<BaseNode, 256>>("Automaton       ", [](const Automaton<BaseNode, 256> &ac) { return uint64_t(ac.m_data.capacity()) * sizeof(ac.m_data[0]) + uint64_t(ac.m_queue.capacity()) * 4; });
+    test<CompactAutomaton<BaseNode, 256>>("CompactAutomaton", [](const CompactAutomaton<BaseNode, 256> &ac) { return uint64_t(ac.m_data.capacity()) * sizeof(ac.m_data[0]) + uint64_t(ac.m_slots.capacity()) * sizeof(ac.m_slots[0]) + uint64_t(ac.m_queue.capacity() + ac.m_root.capacity()) * 4; });
+}
+
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2
+Automaton       : nodes = 338152, memory = 515 MB, build = 1113 ms, scan = 11151 ms, checksum = 6769417904505
+CompactAutomaton: nodes = 338152, memory = 7 MB, build = 148 ms, scan = 6720 ms, checksum = 6769417904505
+
+*/
\ No newline at end of file
@@ -0,0 +1,127 @@
+/*
+本文件在 C++20 标准下编译运行，测量 BigInt 的试商除法与牛顿迭代除法的切换阈值，以及十万位到千万位规模下 BigInt 除法、BigFloat 倒数、除法、平方根与平方根倒数的耗时
+*/
+#include <chrono>
+
+#include "IO/FastIO.h"
+#include "MATH/BigFloat.h"
+
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count()
+using bfloat = OY::BigFloat<10, 6, 10000000>;
+using bint = bfloat::bint;
+void test_thresh() {
+    cout << "n(limbs)  basecase    newton  (us per 2n / n division)" << endl;
+    for (uint32_t m : {16, 32, 64, 128, 192, 256, 384, 512}) {
+        bint a = bint::rand(m * 12), b = bint::rand(m * 6), q, r;
+        uint32_t rounds = 2000000 / (m * m) + 5;
+        uint64_t t[2];
+        for (uint32_t k = 0; k != 2; k++) {
+            bint::s_divBasecase = k ? 5 : m;
+            timer_start;
+            for (uint32_t i = 0; i != rounds; i++) bint::_divide(a, b, q, r);
+            timer_end;
+            t[k] = duration_get / rounds;
+        }
+        cout << m << "\t" << t[0] << "\t" << t[1] << endl;
+    }
+    bint::s_divBasecase = 192;
+}
+void test_large() {
+    for (uint32_t digits : {100000, 1000000, 10000000}) {
+        cout << "digits = " << digits << ":" << endl;
+        bint a = bint::rand(digits * 2), b = bint::rand(digits);
+        timer_start;
+        auto [q, r] = bint::div_mod<true>(a, b);
+        timer_end;
+        cout << "    BigInt 2n / n      " << duration_get / 1000 << " ms, check " << (q * b + r == a && r < b) << endl;
+        bfloat::_K = digits / 6;
+        bfloat x(bint::rand(digits), -int(digits)), two(2), res;
+        timer_start;
+        res = bfloat(1) / x;
+        timer_end;
+        cout << "    BigFloat 1 / x     " << duration_get / 1000 << " ms" << endl;
+        timer_start;
+        res = x.inv();
+        timer_end;
+        cout << "    BigFloat inv       " << duration_get / 1000 << " ms, check " << std::string(res * x).substr(0, 12) << endl;
+        timer_start;
+        res = x.inv_sqrt();
+        timer_end;
+        cout << "    BigFloat inv_sqrt  " << duration_get / 1000 << " ms, check " << std::string(res * res * x).substr(0, 12) << endl;
+        timer_start;
+        res = x.sqrt();
+        timer_end;
+        cout << "    BigFloat sqrt      " << duration_get / 1000 << " ms, check " << std::string(res * res * x.inv()).substr(0, 12) << endl;
+        timer_start;
+        res = two.sqrt();
+        timer_end;
+        cout << "    BigFloat sqrt(2)   " << duration_get / 1000 << " ms, check " << std::string(res).substr(0, 12) << endl;
+    }
+}
+int main() {
+    test_thresh();
+    test_large();
+}
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2
+修改前（除法先把除数左移到被除数一半的长度再整体求逆；没有 inv 与 inv_sqrt ，分别以 bfloat(1) / x 与 bfloat(1) / x.sqrt(2) 代替）：
+digits = 100000:
+    BigInt 2n / n      65 ms, check 1
+    BigFloat 1 / x     58 ms
+    BigFloat inv       59 ms, check 0.9999999999
+    BigFloat inv_sqrt  167 ms, check 0.0000000000
+    BigFloat sqrt      86 ms, check 553617862621
+    BigFloat sqrt(2)   86 ms, check 1.4142135623
+digits = 1000000:
+    BigInt 2n / n      514 ms, check 1
+    BigFloat 1 / x     475 ms
+    BigFloat inv       555 ms, check 0.9999999999
+    BigFloat inv_sqrt  1340 ms, check 0.0000000000
+    BigFloat sqrt      892 ms, check 209740126571
+    BigFloat sqrt(2)   592 ms, check 1.4142135623
+digits = 10000000:
+    BigInt 2n / n      5277 ms, check 1
+    BigFloat 1 / x     6890 ms
+    BigFloat inv       6974 ms, check 0.9999999999
+    BigFloat inv_sqrt  14940 ms, check 0.0000000000
+    BigFloat sqrt      8315 ms, check 764107515381
+    BigFloat sqrt(2)   7198 ms, check 1.4142135623
+（对 x 开方的 check 有误，是初值由 long double 转换时溢出所致，已一并修复）
+
+修改后：
+n(limbs)  basecase    newton  (us per 2n / n division)
+16	1	28
+32	6	48
+64	18	84
+128	70	172
+192	154	179
+256	282	374
+384	647	403
+512	1167	873
+digits = 100000:
+    BigInt 2n / n      41 ms, check 1
+    BigFloat 1 / x     43 ms
+    BigFloat inv       19 ms, check 0.9999999999
+    BigFloat inv_sqrt  36 ms, check 1
+    BigFloat sqrt      29 ms, check 0.9999999999
+    BigFloat sqrt(2)   15 ms, check 1.4142135623
+digits = 1000000:
+    BigInt 2n / n      382 ms, check 1
+    BigFloat 1 / x     391 ms
+    BigFloat inv       174 ms, check 0.9999999999
+    BigFloat inv_sqrt  368 ms, check 1
+    BigFloat sqrt      299 ms, check 0.9999999999
+    BigFloat sqrt(2)   171 ms, check 1.4142135623
+digits = 10000000:
+    BigInt 2n / n      3761 ms, check 1
+    BigFloat 1 / x     3609 ms
+    BigFloat inv       1604 ms, check 1
+    BigFloat inv_sqrt  3597 ms, check 1
+    BigFloat sqrt      3136 ms, check 0.9999999999
+    BigFloat sqrt(2)   1633 ms, check 1.4142135623
+
+*/
@@ -0,0 +1,90 @@
+/*
+本文件在 C++20 标准下编译运行，统计 BigInt 在常见运算模式下的堆分配次数以及耗时
+*/
+#include <chrono>
+#include <cstdlib>
+#include <new>
+
+#include "IO/FastIO.h"
+#include "MATH/BigInt.h"
+
+uint64_t alloc_count;
+void *operator new(size_t n) {
+    alloc_count++;
+    if (void *p = malloc(n)) return p;
+    throw std::bad_alloc();
+}
+void *operator new[](size_t n) {
+    alloc_count++;
+    if (void *p = malloc(n)) return p;
+    throw std::bad_alloc();
+}
+void operator delete(void *p) noexcept { free(p); }
+void operator delete[](void *p) noexcept { free(p); }
+void operator delete(void *p, size_t) noexcept { free(p); }
+void operator delete[](void *p, size_t) noexcept { free(p); }
+
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+using bint = OY::BigInt<>;
+template <typename Func>
+void run(const char *name, Func &&f) {
+    alloc_count = 0;
+    timer_start;
+    auto res = f();
+    timer_end;
+    cout << name << ": allocations = " << alloc_count << ", time = " << duration_get << " ms, check = " << res << endl;
+}
+int main() {
+    run("sum of squares", [] {
+        bint s;
+        for (long long i = 1; i <= 2000000; i++) s += bint(i) * bint(i);
+        return std::string(s);
+    });
+    run("factorial *= i", [] {
+        bint f(1);
+        for (long long i = 1; i <= 20000; i++) f *= i;
+        return f.length();
+    });
+    run("x <<= 1", [] {
+        bint x(1);
+        for (int i = 0; i != 20000; i++) x <<= 1;
+        return x.length();
+    });
+    bint a = bint::rand(2000), b = bint::rand(2000), c = bint::rand(2000), d = bint::rand(2000);
+    run("x = a * b + c * d - x", [&] {
+        bint x;
+        for (int i = 0; i != 2001; i++) x = a * b + c * d - x;
+        return x.length();
+    });
+    run("x = a * b + c * d - x (arena)", [&] {
+        // 临时量都分配在外部缓冲区上，赋值给 x 时拷贝进 x 原有的空间
+        bint x;
+        std::vector<int> pool(1 << 12);
+        for (int i = 0; i != 2001; i++) {
+            bint::Arena arena(pool.data(), pool.size());
+            x = a * b + c * d - x;
+        }
+        return x.length();
+    });
+}
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2
+修改前（每个大数都从堆上申请空间，复合运算生成新对象）：
+sum of squares: allocations = 6667331, time = 144 ms, check = 2666666666667000000
+factorial *= i: allocations = 12871, time = 331 ms, check = 77168
+x <<= 1: allocations = 20001, time = 97 ms, check = 20001
+x = a * b + c * d - x: allocations = 7004, time = 280 ms, check = 4001
+（前两项的 check 有误，是 long long 乘法在 int 上溢出所致，已一并修复）
+
+修改后：
+sum of squares: allocations = 2, time = 92 ms, check = 2666668666667000000
+factorial *= i: allocations = 21, time = 306 ms, check = 77338
+x <<= 1: allocations = 17, time = 88 ms, check = 20001
+x = a * b + c * d - x: allocations = 4003, time = 215 ms, check = 4001
+x = a * b + c * d - x (arena): allocations = 2, time = 218 ms, check = 4001
+
+*/
\ No newline at end of file
@@ -0,0 +1,89 @@
+/*
+本文件在 C++20 标准下编译运行，测量 BinaryBigInt 各乘法算法在不同规模下的耗时，以确定 Threshold 中的切换阈值；并测量十进制字符串转换的耗时
+*/
+#include <chrono>
+#include <random>
+
+#include "IO/FastIO.h"
+#include "MATH/BinaryBigInt.h"
+
+std::mt19937_64 rr;
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count()
+using namespace OY::BINBIG;
+vec random_vec(size_type n) {
+    vec x(n);
+    for (auto &a : x) a = rr();
+    return x;
+}
+template <typename Mul>
+uint64_t time_mul(size_type n, Mul mul) {
+    vec a = random_vec(n), b = random_vec(n), r(n * 2);
+    size_type rounds = std::max<size_type>(1, 2000000 / (n * n)) + 2;
+    timer_start;
+    for (size_type i = 0; i != rounds; i++) mul(r.data(), a.data(), n, b.data(), n);
+    timer_end;
+    return duration_get * 1000 / rounds;
+}
+void test_mul() {
+    cout << "n(limbs)    basecase   karatsuba       toom3         ntt  (ns per multiply)" << endl;
+    for (size_type n : {8, 16, 24, 32, 48, 64, 96, 128, 192, 256, 384, 512, 768, 1024, 1536, 2048, 4096}) {
+        cout << n << "\t" << time_mul(n, _mul_basecase) << "\t" << time_mul(n, _karatsuba) << "\t" << time_mul(n, _toom3) << "\t" << time_mul(n, _ntt_mul) << endl;
+    }
+}
+void test_radix() {
+    for (size_type digits : {10000, 100000, 1000000}) {
+        std::string s(digits, '0');
+        for (auto &c : s) c = '0' + rr() % 10;
+        s[0] = '1' + rr() % 9;
+        timer_start;
+        OY::BinaryBigInt x(s);
+        timer_end;
+        auto t_from = duration_get;
+        timer_start;
+        std::string back = x.to_string();
+        timer_end;
+        cout << "digits = " << digits << ": from_string " << t_from << " us, to_string " << duration_get << " us, check " << (back == s) << endl;
+        if (digits <= 100000) {
+            timer_start;
+            std::vector<limb> chunks;
+            _to_chunks(x.m_data, chunks, (digits + dec_width - 1) / dec_width);
+            timer_end;
+            cout << "    quadratic to_string " << duration_get << " us" << endl;
+        }
+    }
+}
+int main() {
+    test_mul();
+    test_radix();
+}
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2
+n(limbs)    basecase   karatsuba       toom3         ntt  (ns per multiply)
+8	75	327	1598	2788
+16	321	543	1754	4073
+24	634	747	1895	7126
+32	887	1083	2157	10819
+48	3977	3625	6373	16366
+64	4759	4932	6118	17838
+96	10479	8529	10881	36269
+128	19040	15266	15112	36983
+192	58625	27017	28642	76625
+256	74750	70906	43906	73656
+384	161733	87733	121066	164800
+512	257444	182333	201555	253888
+768	1074200	565600	466800	715000
+1024	1556333	453666	441666	397000
+1536	2520000	897333	799333	870333
+2048	4893666	1872000	1304333	965666
+4096	24865000	3247666	5141333	2083333
+digits = 10000: from_string 349 us, to_string 1908 us, check 1
+    quadratic to_string 1177 us
+digits = 100000: from_string 8721 us, to_string 29155 us, check 1
+    quadratic to_string 93173 us
+digits = 1000000: from_string 115773 us, to_string 334865 us, check 1
+
+*/
\ No newline at end of file
@@ -0,0 +1,71 @@
+/*
+本文件在 C++20 标准下编译运行，比较 Eratosthenes 、 EulerSieve 与 CompactSieve 记录最小质因数时的打表耗时、占用空间与分解质因数的耗时
+*/
+#include <chrono>
+#include <random>
+
+#include "IO/FastIO.h"
+#include "MATH/CompactSieve.h"
+#include "MATH/Eratosthenes.h"
+#include "MATH/EulerSieve.h"
+
+std::mt19937 rr;
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+static constexpr uint32_t N = 100000000, Q = 10000000;
+std::vector<uint32_t> queries;
+template <typename Sieve>
+void test_decomposite(const Sieve &ps) {
+    uint64_t sum = 0;
+    timer_start;
+    for (auto x : queries)
+        for (auto &&pair : ps.decomposite(x)) sum += pair.m_prime * pair.m_count;
+    timer_end;
+    cout << ", decomposite " << duration_get << " ms, sum = " << sum << endl;
+}
+void test_eratosthenes() {
+    timer_start;
+    OY::Eratosthenes::Sieve<N, false, true> ps;
+    timer_end;
+    cout << "Eratosthenes<1e8>:    build " << duration_get << " ms, " << (sizeof(ps.s_smallest_factor) + sizeof(ps.s_isprime) + sizeof(ps.s_primes)) / (1 << 20) << " MB";
+    test_decomposite(ps);
+}
+void test_euler() {
+    timer_start;
+    OY::EulerSieve::Sieve<N, false, true> ps;
+    timer_end;
+    cout << "EulerSieve<1e8>:      build " << duration_get << " ms, " << (sizeof(ps.s_smallest_factor) + sizeof(ps.s_isprime) + sizeof(ps.s_primes)) / (1 << 20) << " MB";
+    test_decomposite(ps);
+}
+template <uint32_t ThreadNum>
+void test_compact(uint32_t range) {
+    timer_start;
+    OY::CompactSieve::Sieve<ThreadNum> ps(range);
+    timer_end;
+    cout << "CompactSieve<" << ThreadNum << ">(" << range << "): build " << duration_get << " ms, " << ps.m_factor.size() * sizeof(OY::CompactSieve::factor_type) / (1 << 20) << " MB";
+    test_decomposite(ps);
+}
+int main() {
+    queries.resize(Q);
+    for (auto &x : queries) x = rr() % N + 1;
+    test_eratosthenes();
+    test_euler();
+    test_compact<1>(N);
+    test_compact<4>(N);
+    test_compact<1>(1000000000);
+    test_compact<4>(1000000000);
+}
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2 -pthread
+(测试机为单核，所以多线程版本没有加速)
+Eratosthenes<1e8>:    build 1080 ms, 415 MB, decomposite 5699 ms, sum = 47542234556413
+EulerSieve<1e8>:      build 1542 ms, 415 MB, decomposite 5570 ms, sum = 47542234556413
+CompactSieve<1>(100000000): build 120 ms, 50 MB, decomposite 2586 ms, sum = 47542234556413
+CompactSieve<4>(100000000): build 134 ms, 50 MB, decomposite 3341 ms, sum = 47542234556413
+CompactSieve<1>(1000000000): build 1497 ms, 508 MB, decomposite 3446 ms, sum = 47542234556413
+CompactSieve<4>(1000000000): build 1454 ms, 508 MB, decomposite 2769 ms, sum = 47542234556413
+
+*/
@@ -0,0 +1,131 @@
+/*
+本文件在 C++20 标准下编译运行，比较求常系数齐次线性递推第 n 项时，矩阵快速幂、 BostonMori_fill 与 LinearRecurrence 单次、批量查询的耗时，以及 Berlekamp-Massey 的耗时
+*/
+#include <chrono>
+#include <random>
+
+#include "IO/FastIO.h"
+#include "MATH/BostonMori.h"
+#include "MATH/DynamicMatrix.h"
+#include "MATH/LinearRecurrence.h"
+#include "MATH/StaticModInt32.h"
+
+std::mt19937_64 rr;
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+using mint = OY::StaticModInt32<998244353, true>;
+using poly = OY::NTTPolynomial<mint, 1 << 20>;
+using mat = OY::DynamicMatrix<mint>;
+using LR = OY::LinearRecurrence<poly>;
+poly random_poly(uint32_t n) {
+    poly res(n);
+    for (auto &x : res) x = uint32_t(rr());
+    return res;
+}
+mint by_matrix(const poly &init, const poly &weight, uint64_t n) {
+    const uint32_t k = init.size();
+    auto trans = mat::raw(k, k, 0), row = mat::raw(1, k);
+    for (uint32_t i = 0; i != k; i++) trans[i][k - 1] = weight[k - 1 - i], row[0][i] = init[i];
+    for (uint32_t i = 1; i != k; i++) trans[i][i - 1] = 1;
+    return (row * trans.pow(n))[0][0];
+}
+void test_single() {
+    for (uint32_t k : {16, 64, 128, 1000, 10000}) {
+        poly init = random_poly(k), weight = random_poly(k);
+        const uint64_t n = rr() >> 4;
+        cout << "k = " << k << ", n = " << n << ":" << endl;
+        mint x;
+        if (k <= 128) {
+            timer_start;
+            x = by_matrix(init, weight, n);
+            timer_end;
+            cout << "    matrix pow          " << duration_get << " ms, " << x << endl;
+        }
+        timer_start;
+        x = OY::BostonMori_fill(init, weight, n);
+        timer_end;
+        cout << "    BostonMori_fill     " << duration_get << " ms, " << x << endl;
+        LR lr(init, weight);
+        timer_start;
+        x = lr.query(n);
+        timer_end;
+        cout << "    LinearRecurrence    " << duration_get << " ms, " << x << endl;
+        timer_start;
+        x = lr.query(n);
+        timer_end;
+        cout << "    (second query)      " << duration_get << " ms, " << x << endl;
+    }
+}
+void test_batch() {
+    for (uint32_t k : {100, 1000}) {
+        poly init = random_poly(k), weight = random_poly(k);
+        std::vector<uint64_t> ns(k == 100 ? 2000 : 500);
+        for (auto &n : ns) n = rr() >> 4;
+        LR lr(init, weight);
+        timer_start;
+        mint sum1 = 0;
+        for (auto n : ns) sum1 += OY::BostonMori_fill(init, weight, n);
+        timer_end;
+        auto t_naive = duration_get;
+        timer_start;
+        auto res = lr.query(ns);
+        timer_end;
+        mint sum2 = 0;
+        for (auto x : res) sum2 += x;
+        cout << "k = " << k << ", " << ns.size() << " queries: BostonMori_fill " << t_naive << " ms, batched " << duration_get << " ms, check " << (sum1 == sum2) << endl;
+    }
+}
+void test_bm() {
+    for (uint32_t k : {1000, 5000, 10000}) {
+        poly init = random_poly(k), weight = random_poly(k);
+        LR lr(init, weight);
+        std::vector<uint64_t> ns(k * 2);
+        for (uint32_t i = 0; i != k * 2; i++) ns[i] = i;
+        auto seq = lr.query(ns);
+        timer_start;
+        LR lr2 = LR::fromSequence(poly(seq.begin(), seq.end()));
+        timer_end;
+        cout << "Berlekamp-Massey on " << k * 2 << " terms: " << duration_get << " ms, check " << (lr2.weight() == weight) << endl;
+    }
+}
+int main() {
+    poly::s_primitiveRoot = 3;
+    test_single();
+    test_batch();
+    test_bm();
+}
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2
+k = 16, n = 895872493762437135:
+    matrix pow          0 ms, 35742374
+    BostonMori_fill     0 ms, 35742374
+    LinearRecurrence    0 ms, 35742374
+    (second query)      0 ms, 35742374
+k = 64, n = 1001573149755157583:
+    matrix pow          52 ms, 342371238
+    BostonMori_fill     1 ms, 342371238
+    LinearRecurrence    1 ms, 342371238
+    (second query)      0 ms, 342371238
+k = 128, n = 493705926944754969:
+    matrix pow          362 ms, 653522069
+    BostonMori_fill     3 ms, 653522069
+    LinearRecurrence    3 ms, 653522069
+    (second query)      0 ms, 653522069
+k = 1000, n = 1149884354974095653:
+    BostonMori_fill     22 ms, 282424157
+    LinearRecurrence    23 ms, 282424157
+    (second query)      6 ms, 282424157
+k = 10000, n = 578682517655094446:
+    BostonMori_fill     486 ms, 169994468
+    LinearRecurrence    420 ms, 169994468
+    (second query)      138 ms, 169994468
+k = 100, 2000 queries: BostonMori_fill 3981 ms, batched 999 ms, check 1
+k = 1000, 500 queries: BostonMori_fill 10592 ms, batched 2071 ms, check 1
+Berlekamp-Massey on 2000 terms: 6 ms, check 1
+Berlekamp-Massey on 10000 terms: 214 ms, check 1
+Berlekamp-Massey on 20000 terms: 520 ms, check 1
+
+*/
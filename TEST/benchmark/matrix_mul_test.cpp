@@ -0,0 +1,108 @@
+/*
+本文件在 C++20 标准下编译运行，比较 DynamicMatrix 在模数下原本的三重循环乘法与分块、延迟取模、多线程乘法的耗时
+*/
+#include <chrono>
+#include <random>
+
+#include "IO/FastIO.h"
+#include "MATH/DynamicMatrix.h"
+#include "MATH/StaticModInt32.h"
+#include "MATH/StaticMontgomeryModInt32.h"
+
+std::mt19937 rr;
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+// 修改前的乘法
+template <typename Matrix>
+Matrix naive_mul(const Matrix &a, const Matrix &b) {
+    const uint32_t m = a.row(), n = a.column(), l = b.column();
+    auto res = Matrix::raw(m, l, 0);
+    for (uint32_t i = 0; i != m; i++)
+        for (uint32_t j = 0; j != n; j++) {
+            auto x = a[i][j];
+            for (uint32_t k = 0; k != l; k++) res[i][k] += x * b[j][k];
+        }
+    return res;
+}
+template <typename Matrix>
+Matrix naive_pow(Matrix a, uint64_t n) {
+    Matrix res = Matrix::unit(a.row());
+    while (n) {
+        if (n & 1) res = naive_mul(res, a);
+        if (n >>= 1) a = naive_mul(a, a);
+    }
+    return res;
+}
+template <typename Matrix>
+Matrix random_matrix(uint32_t m, uint32_t n) {
+    auto res = Matrix::raw(m, n);
+    for (uint32_t i = 0; i != m; i++)
+        for (uint32_t j = 0; j != n; j++) res[i][j] = uint32_t(rr());
+    return res;
+}
+template <typename mint>
+void test(const char *name) {
+    using mat = OY::DynamicMatrix<mint>;
+    using mat4 = OY::DynamicMatrix<mint, 4>;
+    cout << name << ":" << endl;
+    for (uint32_t n : {256, 512, 1024}) {
+        mat a = random_matrix<mat>(n, n), b = random_matrix<mat>(n, n);
+        mat4 a4(n, n, a.m_val), b4(n, n, b.m_val);
+        timer_start;
+        mat c = naive_mul(a, b);
+        timer_end;
+        auto t_naive = duration_get;
+        timer_start;
+        mat d = a * b;
+        timer_end;
+        auto t_block = duration_get;
+        timer_start;
+        mat4 e = a4 * b4;
+        timer_end;
+        cout << "    n = " << n << ": naive " << t_naive << " ms, blocked " << t_block << " ms, 4 threads " << duration_get << " ms, check " << (c == d && std::equal(std::begin(c.m_val), std::end(c.m_val), std::begin(e.m_val))) << endl;
+    }
+    mat a = random_matrix<mat>(384, 384);
+    timer_start;
+    mat c = naive_pow(a, 1000);
+    timer_end;
+    auto t_naive = duration_get;
+    timer_start;
+    mat d = a.pow(1000);
+    timer_end;
+    cout << "    n = 384, pow(1000): naive " << t_naive << " ms, blocked " << duration_get << " ms, check " << (c == d) << endl;
+}
+int main() {
+    test<OY::StaticModInt32<1000000007, false>>("StaticModInt32<1000000007>");
+    test<OY::StaticMontgomeryModInt32<998244353, true>>("StaticMontgomeryModInt32<998244353>");
+}
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2 -pthread
+（测试机只有一个核心，多线程一栏仅验证正确性）
+StaticModInt32<1000000007>:
+    n = 256: naive 43 ms, blocked 28 ms, 4 threads 23 ms, check 1
+    n = 512: naive 338 ms, blocked 196 ms, 4 threads 159 ms, check 1
+    n = 1024: naive 2167 ms, blocked 1079 ms, 4 threads 1122 ms, check 1
+    n = 384, pow(1000): naive 1611 ms, blocked 984 ms, check 1
+StaticMontgomeryModInt32<998244353>:
+    n = 256: naive 52 ms, blocked 16 ms, 4 threads 17 ms, check 1
+    n = 512: naive 261 ms, blocked 100 ms, 4 threads 136 ms, check 1
+    n = 1024: naive 2223 ms, blocked 760 ms, 4 threads 789 ms, check 1
+    n = 384, pow(1000): naive 1659 ms, blocked 596 ms, check 1
+
+g++ -std=c++20 -DOY_LOCAL -O2 -mavx2 -pthread
+（最内层循环被自动向量化）
+StaticModInt32<1000000007>:
+    n = 256: naive 32 ms, blocked 5 ms, 4 threads 5 ms, check 1
+    n = 512: naive 240 ms, blocked 39 ms, 4 threads 40 ms, check 1
+    n = 1024: naive 1946 ms, blocked 301 ms, 4 threads 286 ms, check 1
+    n = 384, pow(1000): naive 1651 ms, blocked 207 ms, check 1
+StaticMontgomeryModInt32<998244353>:
+    n = 256: naive 35 ms, blocked 4 ms, 4 threads 5 ms, check 1
+    n = 512: naive 258 ms, blocked 43 ms, 4 threads 39 ms, check 1
+    n = 1024: naive 2128 ms, blocked 308 ms, 4 threads 295 ms, check 1
+    n = 384, pow(1000): naive 1714 ms, blocked 203 ms, check 1
+
+*/
@@ -0,0 +1,108 @@
+/*
+本文件在 C++20 标准下编译运行，测量 DynamicMatrix 中 Strassen-Winograd 递归乘法相对于分块乘法的切换阈值，以及大规模下两者的耗时。测试机噪声较大，一层递归的比较只能看出在 n 为数百时两者已接近，默认阈值按 n = 2048 时各阈值的总耗时选取
+*/
+#include <chrono>
+#include <random>
+
+#include "IO/FastIO.h"
+#include "MATH/DynamicMatrix.h"
+#include "MATH/StaticModInt32.h"
+
+std::mt19937 rr;
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+using mint = OY::StaticModInt32<998244353, true>;
+using mat = OY::DynamicMatrix<mint>;
+mat random_matrix(uint32_t n) {
+    auto res = mat::raw(n, n);
+    for (auto &x : res.m_val) x = uint32_t(rr());
+    return res;
+}
+template <typename Callback>
+int64_t best_of_three(Callback &&call) {
+    int64_t res = INT64_MAX;
+    for (uint32_t i = 0; i != 3; i++) {
+        timer_start;
+        call();
+        timer_end;
+        res = std::min<int64_t>(res, duration_get);
+    }
+    return res;
+}
+void test_thresh() {
+    // 只递归一层，与直接分块乘法比较
+    cout << "n     blocked  one level  (ms, best of 3)" << endl;
+    for (uint32_t n : {256, 384, 512, 640, 768, 896, 1024, 1280}) {
+        mat a = random_matrix(n), b = random_matrix(n), c, d;
+        mat::s_strassen = false;
+        auto t_block = best_of_three([&] { c = a * b; });
+        mat::s_strassen = true, mat::s_strassenThreshold = n - 1;
+        auto t_strassen = best_of_three([&] { d = a * b; });
+        cout << n << "\t" << t_block << "\t" << t_strassen << "\t" << (c == d) << endl;
+    }
+}
+void test_recursion() {
+    // 固定 n = 2048 完整递归，比较不同阈值下的总耗时
+    mat a = random_matrix(2048), b = random_matrix(2048), c, d;
+    mat::s_strassen = false;
+    timer_start;
+    c = a * b;
+    timer_end;
+    cout << "n = 2048: blocked " << duration_get << " ms" << endl;
+    mat::s_strassen = true;
+    uint32_t best = 0;
+    int64_t best_time = INT64_MAX;
+    for (uint32_t thresh : {1024, 768, 512, 384, 256, 192}) {
+        mat::s_strassenThreshold = thresh;
+        timer_start;
+        d = a * b;
+        timer_end;
+        if (duration_get < best_time) best = thresh, best_time = duration_get;
+        cout << "    strassen, threshold = " << thresh << ": " << duration_get << " ms, check " << (c == d) << endl;
+    }
+    cout << "best threshold = " << best << endl;
+}
+void test_large() {
+    mat::s_strassenThreshold = 256;
+    mat a = random_matrix(3000), b = random_matrix(3000);
+    mat::s_strassen = false;
+    timer_start;
+    mat c = a * b;
+    timer_end;
+    auto t_block = duration_get;
+    mat::s_strassen = true;
+    timer_start;
+    mat d = a * b;
+    timer_end;
+    cout << "n = 3000: blocked " << t_block << " ms, strassen " << duration_get << " ms, check " << (c == d) << endl;
+}
+int main() {
+    test_thresh();
+    test_recursion();
+    test_large();
+}
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2 -pthread
+n     blocked  one level  (ms, best of 3)
+256	12	10	1
+384	37	35	1
+512	95	75	1
+640	195	168	1
+768	354	339	1
+896	545	567	1
+1024	865	1082	1
+1280	1639	1609	1
+n = 2048: blocked 9023 ms
+    strassen, threshold = 1024: 9933 ms, check 1
+    strassen, threshold = 768: 6987 ms, check 1
+    strassen, threshold = 512: 8218 ms, check 1
+    strassen, threshold = 384: 6596 ms, check 1
+    strassen, threshold = 256: 5169 ms, check 1
+    strassen, threshold = 192: 5331 ms, check 1
+best threshold = 256
+n = 3000: blocked 23999 ms, strassen 14897 ms, check 1
+
+*/
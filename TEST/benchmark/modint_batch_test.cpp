@@ -0,0 +1,98 @@
+/*
+本文件在 C++20 标准下编译运行，比较四种动态模数类型与 Barrett 逐个求幂与 pow_batch 批量求幂的耗时，以及 ThreadLocal 模数下逐个乘法的耗时
+*/
+#include <chrono>
+#include <random>
+#include <vector>
+
+#include "IO/FastIO.h"
+#include "MATH/Barrett.h"
+#include "MATH/DynamicModInt32.h"
+#include "MATH/DynamicModInt64.h"
+#include "MATH/DynamicMontgomeryModInt32.h"
+#include "MATH/DynamicMontgomeryModInt64.h"
+
+std::mt19937_64 rr;
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+
+template <typename Tp>
+void test_pow(const char *name, uint64_t P, uint32_t n) {
+    Tp::set_mod(P, true);
+    std::vector<Tp> a(n), b(n), c(n);
+    for (auto &x : a) x = rr();
+    timer_start;
+    for (uint32_t i = 0; i != n; i++) b[i] = a[i].pow(P - 2);
+    timer_end;
+    cout << name << ", " << n << " inverses:" << endl;
+    cout << "    pow:       " << duration_get << " ms" << endl;
+    timer_start;
+    Tp::pow_batch(a.data(), P - 2, c.data(), n);
+    timer_end;
+    cout << "    pow_batch: " << duration_get << " ms, check " << (b == c) << endl;
+}
+
+template <typename Tp>
+void test_barrett(const char *name, Tp P, uint32_t n) {
+    OY::Barrett<Tp> brt(P);
+    std::vector<Tp> a(n), b(n), c(n);
+    for (auto &x : a) x = rr() % P;
+    timer_start;
+    for (uint32_t i = 0; i != n; i++) b[i] = brt.pow(a[i], P - 2);
+    timer_end;
+    cout << name << ", " << n << " inverses:" << endl;
+    cout << "    pow:       " << duration_get << " ms" << endl;
+    timer_start;
+    brt.pow_batch(a.data(), P - 2, c.data(), n);
+    timer_end;
+    cout << "    pow_batch: " << duration_get << " ms, check " << (b == c) << endl;
+}
+
+template <typename Tp>
+void test_prod(const char *name) {
+    Tp::set_mod(1000000007, true);
+    timer_start;
+    Tp prod = 1;
+    for (uint32_t i = 1; i <= 100000000; i++) prod *= i;
+    timer_end;
+    cout << name << ", prod of [1, 1e8]: " << duration_get << " ms, " << prod << endl;
+}
+
+int main() {
+    test_pow<OY::DynamicModInt32<0>>("DynamicModInt32", 1000000007, 1 << 20);
+    test_pow<OY::DynamicMontgomeryModInt32<0>>("DynamicMontgomeryModInt32", 1000000007, 1 << 20);
+    test_pow<OY::DynamicModInt64<0>>("DynamicModInt64", 4611686018427387847, 1 << 17);
+    test_pow<OY::DynamicMontgomeryModInt64<0>>("DynamicMontgomeryModInt64", 4611686018427387847, 1 << 17);
+    test_barrett<uint32_t>("Barrett32", 1000000007, 1 << 20);
+    test_barrett<uint64_t>("Barrett64", 4611686018427387847, 1 << 17);
+    test_prod<OY::DynamicModInt32<1>>("DynamicModInt32<1>");
+    test_prod<OY::DynamicModInt32<1, true>>("DynamicModInt32<1, true>");
+}
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2 -mavx2
+DynamicModInt32, 1048576 inverses:
+    pow:       156 ms
+    pow_batch: 82 ms, check 1
+DynamicMontgomeryModInt32, 1048576 inverses:
+    pow:       167 ms
+    pow_batch: 43 ms, check 1
+DynamicModInt64, 131072 inverses:
+    pow:       184 ms
+    pow_batch: 27 ms, check 1
+DynamicMontgomeryModInt64, 131072 inverses:
+    pow:       46 ms
+    pow_batch: 26 ms, check 1
+Barrett32, 1048576 inverses:
+    pow:       186 ms
+    pow_batch: 97 ms, check 1
+Barrett64, 131072 inverses:
+    pow:       149 ms
+    pow_batch: 31 ms, check 1
+DynamicModInt32<1>, prod of [1, 1e8]: 627 ms, 927880474
+DynamicModInt32<1, true>, prod of [1, 1e8]: 627 ms, 927880474
+(不加 -mavx2 时，DynamicMontgomeryModInt32 的 pow_batch 约为 86 ms)
+
+*/
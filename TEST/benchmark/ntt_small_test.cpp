@@ -0,0 +1,61 @@
+/*
+本文件在 C++20 标准下编译运行，测试 NTTPolynomial 在变换长度不超过 4096 时一次 dft 加一次 idft 的耗时
+对于 StaticModInt32 与 StaticMontgomeryModInt32 ，这一范围内的单位根、位逆序表以及长度的逆元在编译期生成，变换按长度分派到各自实例化的版本
+*/
+#include <chrono>
+#include <random>
+
+#include "IO/FastIO.h"
+#include "MATH/NTTPolynomial.h"
+#include "MATH/StaticModInt32.h"
+#include "MATH/StaticMontgomeryModInt32.h"
+
+std::mt19937 rr;
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()
+template <typename Tp>
+void test(const char *name) {
+    using poly = OY::NTTPolynomial<Tp, 1 << 20>;
+    poly::s_primitiveRoot = 3;
+    std::vector<Tp> a(4096);
+    for (auto &x : a) x = uint32_t(rr());
+    cout << name << ":" << endl;
+    for (uint32_t n : {8, 64, 512, 4096}) {
+        const uint32_t rounds = (1 << 25) / n / std::bit_width(n);
+        timer_start;
+        for (uint32_t r = 0; r != rounds; r++) poly::idft(poly::dft(a.data(), n), n);
+        timer_end;
+        cout << "    n = " << n << ", " << rounds << " rounds: " << duration_get / rounds << " ns per round" << endl;
+    }
+    // dft 与 idft 互逆，反复变换后数组应当不变
+    std::mt19937 check(0);
+    bool ok = true;
+    for (auto &x : a) ok &= x == Tp(uint32_t(check()));
+    cout << "    check " << ok << endl;
+}
+int main() {
+    rr.seed(0);
+    test<OY::StaticModInt32<998244353, true>>("NTTPolynomial<StaticModInt32>");
+    rr.seed(0);
+    test<OY::mgint998244353>("NTTPolynomial<StaticMontgomeryModInt32>");
+}
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2
+NTTPolynomial<StaticModInt32>:
+    n = 8, 1048576 rounds: 131 ns per round
+    n = 64, 74898 rounds: 1746 ns per round
+    n = 512, 6553 rounds: 20120 ns per round
+    n = 4096, 630 rounds: 206402 ns per round
+    check 1
+NTTPolynomial<StaticMontgomeryModInt32>:
+    n = 8, 1048576 rounds: 167 ns per round
+    n = 64, 74898 rounds: 2044 ns per round
+    n = 512, 6553 rounds: 24176 ns per round
+    n = 4096, 630 rounds: 246187 ns per round
+    check 1
+(作为对照，运行期准备单位根时，两种类型在 n = 8 时分别为 289 ns 与 364 ns ，n = 64 时分别为 2016 ns 与 2357 ns ，更长时无明显差别)
+
+*/
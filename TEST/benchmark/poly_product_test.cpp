@@ -0,0 +1,106 @@
+/*
+本文件在 C++20 标准下编译运行，比较 FFTPolynomial 与 MTTPolynomial 中整段补零乘法与截断乘法、中段乘积、带余除法的耗时
+*/
+#include <chrono>
+#include <random>
+
+#include "IO/FastIO.h"
+#include "MATH/FFTPolynomial.h"
+#include "MATH/MTTPolynomial.h"
+#include "MATH/StaticModInt32.h"
+
+std::mt19937 rr;
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+using fpoly = OY::FFTPolynomial<uint64_t, 1 << 22, double>;
+using mint = OY::StaticModInt32<1000000007, true>;
+using mpoly = OY::MTTPolynomial<mint, 1 << 21>;
+template <typename Poly>
+Poly random_poly(uint32_t n, uint32_t lim) {
+    Poly a(n);
+    for (auto &x : a) x = uint32_t(rr() % lim);
+    return a;
+}
+template <typename Poly>
+void test(const char *name, uint32_t lim) {
+    cout << name << ":" << endl;
+    for (uint32_t n : {300000, 350000, 500000}) {
+        Poly a = random_poly<Poly>(n, lim), b = random_poly<Poly>(n, lim);
+        timer_start;
+        Poly full = Poly::product(a, b, std::__bit_ceil(n * 2 - 1));
+        timer_end;
+        auto t_full = duration_get;
+        timer_start;
+        Poly res = a * b;
+        timer_end;
+        cout << "    n = " << n << ": a * b  full " << t_full << " ms, truncated " << duration_get << " ms, check " << std::equal(res.begin(), res.end(), full.begin()) << endl;
+        timer_start;
+        full = Poly::product(a, b, std::__bit_ceil(n * 2 - 1));
+        timer_end;
+        t_full = duration_get;
+        timer_start;
+        res = Poly::productFirst(a, b, n);
+        timer_end;
+        cout << "    n = " << n << ": first n  full " << t_full << " ms, productFirst " << duration_get << " ms, check " << std::equal(res.begin(), res.end(), full.begin()) << endl;
+        Poly c = random_poly<Poly>(n * 2 - 1, lim);
+        timer_start;
+        full = Poly::product(c, a, std::__bit_ceil(n * 3 - 2));
+        timer_end;
+        t_full = duration_get;
+        timer_start;
+        res = Poly::productMiddle(c, a);
+        timer_end;
+        cout << "    n = " << n << ": middle  full " << t_full << " ms, productMiddle " << duration_get << " ms, check " << std::equal(res.begin(), res.end(), full.begin() + (n - 1)) << endl;
+    }
+}
+void test_divmod() {
+    for (uint32_t n : {300000, 1000000}) {
+        mpoly a = random_poly<mpoly>(n, 1000000007), b = random_poly<mpoly>(n / 2, 1000000007);
+        b.back() = 1;
+        timer_start;
+        auto [q, r] = a.divmod(b);
+        timer_end;
+        cout << "MTT divmod " << n << " / " << n / 2 << ": " << duration_get << " ms, check " << (q * b + r == a) << endl;
+    }
+}
+int main() {
+    // 预先准备好各长度的单位根与位逆序表，避免计入首次运算的耗时
+    for (uint32_t len = 2; len <= 1 << 21; len *= 2) fpoly::prepareDFT(len), mpoly::prepareDFT(len);
+    test<fpoly>("FFTPolynomial", 1000);
+    test<mpoly>("MTTPolynomial", 1000000007);
+    test_divmod();
+}
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2
+FFTPolynomial:
+    n = 300000: a * b  full 194 ms, truncated 93 ms, check 1
+    n = 300000: first n  full 170 ms, productFirst 91 ms, check 1
+    n = 300000: middle  full 162 ms, productMiddle 125 ms, check 1
+    n = 350000: a * b  full 125 ms, truncated 120 ms, check 1
+    n = 350000: first n  full 134 ms, productFirst 94 ms, check 1
+    n = 350000: middle  full 423 ms, productMiddle 163 ms, check 1
+    n = 500000: a * b  full 182 ms, truncated 144 ms, check 1
+    n = 500000: first n  full 172 ms, productFirst 156 ms, check 1
+    n = 500000: middle  full 410 ms, productMiddle 150 ms, check 1
+MTTPolynomial:
+    n = 300000: a * b  full 234 ms, truncated 95 ms, check 1
+    n = 300000: first n  full 192 ms, productFirst 91 ms, check 1
+    n = 300000: middle  full 207 ms, productMiddle 225 ms, check 1
+    n = 350000: a * b  full 202 ms, truncated 141 ms, check 1
+    n = 350000: first n  full 204 ms, productFirst 167 ms, check 1
+    n = 350000: middle  full 538 ms, productMiddle 189 ms, check 1
+    n = 500000: a * b  full 200 ms, truncated 192 ms, check 1
+    n = 500000: first n  full 207 ms, productFirst 181 ms, check 1
+    n = 500000: middle  full 469 ms, productMiddle 185 ms, check 1
+修改前（余数通过完整乘积 g * q 求得）：
+MTT divmod 300000 / 150000: 159 ms, check 1
+MTT divmod 1000000 / 500000: 460 ms, check 1
+
+修改后：
+MTT divmod 300000 / 150000: 98 ms, check 1
+MTT divmod 1000000 / 500000: 307 ms, check 1
+
+*/
@@ -0,0 +1,67 @@
+/*
+本文件在 C++20 标准下编译运行，比较用 SegmentedSieve 逐段计数与用 LucyTable 求质数个数的耗时，以及多线程与 Min25_sum 的耗时
+*/
+#include <chrono>
+
+#include "IO/FastIO.h"
+#include "MATH/PrimeCounting.h"
+#include "MATH/StaticModInt32.h"
+
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+using mint = OY::StaticModInt32<998244353, true>;
+void test_count() {
+    for (uint64_t n : {1000000000ull, 10000000000ull}) {
+        timer_start;
+        uint64_t x = OY::SIEVE::SegmentedSieve<>().count(0, n + 1);
+        timer_end;
+        cout << "n = " << n << ": SegmentedSieve " << duration_get << " ms, " << x;
+        timer_start;
+        x = OY::PRIMECOUNT::prime_count(n);
+        timer_end;
+        cout << ", prime_count " << duration_get << " ms, " << x << endl;
+    }
+    for (uint64_t n : {100000000000ull, 1000000000000ull, 10000000000000ull}) {
+        timer_start;
+        uint64_t x = OY::PRIMECOUNT::prime_count(n);
+        timer_end;
+        cout << "n = " << n << ": prime_count " << duration_get << " ms, " << x;
+        timer_start;
+        x = OY::PRIMECOUNT::prime_count<4>(n);
+        timer_end;
+        cout << ", prime_count<4> " << duration_get << " ms, " << x << endl;
+    }
+}
+void test_sum() {
+    for (uint64_t n : {10000000000ull, 1000000000000ull}) {
+        timer_start;
+        mint x = OY::PRIMECOUNT::prime_sum<mint>(n);
+        timer_end;
+        cout << "n = " << n << ": prime_sum " << duration_get << " ms, " << x;
+        timer_start;
+        OY::PRIMECOUNT::LucyTable<mint> cnt(n, [](uint64_t v) { return mint(v - 1); }, [](uint32_t) { return mint(1); });
+        OY::PRIMECOUNT::LucyTable<mint> sum(n, [](uint64_t v) { return (v & 1 ? mint(v) * mint((v + 1) / 2) : mint(v / 2) * mint(v + 1)) - 1; }, [](uint32_t p) { return mint(p); });
+        x = OY::PRIMECOUNT::Min25_sum<mint>(n, cnt.primes(), [&](uint64_t v) { return sum.query(v) - cnt.query(v); }, [](uint64_t p, uint32_t, uint64_t pe) { return mint(pe / p * (p - 1)); });
+        timer_end;
+        cout << ", sum of phi " << duration_get << " ms, " << x << endl;
+    }
+}
+int main() {
+    test_count();
+    test_sum();
+}
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2 -pthread
+(测试机为单核，所以多线程版本没有加速)
+n = 1000000000: SegmentedSieve 489 ms, 50847534, prime_count 9 ms, 50847534
+n = 10000000000: SegmentedSieve 6746 ms, 455052511, prime_count 47 ms, 455052511
+n = 100000000000: prime_count 255 ms, 4118054813, prime_count<4> 313 ms, 4118054813
+n = 1000000000000: prime_count 1320 ms, 37607912018, prime_count<4> 1210 ms, 37607912018
+n = 10000000000000: prime_count 6072 ms, 346065536839, prime_count<4> 8367 ms, 346065536839
+n = 10000000000: prime_sum 108 ms, 94769928, sum of phi 387 ms, 866849765
+n = 1000000000000: prime_sum 3227 ms, 492596661, sum of phi 10220 ms, 213355976
+
+*/
@@ -0,0 +1,76 @@
+/*
+本文件在 C++20 标准下编译运行，以 f[n] = sum f[i] * g[n - i] 型的在线递推为例，比较 NTTPolynomial::RelaxedConvolution 与手写分治（CDQ）、离线求逆的耗时
+*/
+#include <chrono>
+#include <random>
+
+#include "IO/FastIO.h"
+#include "MATH/NTTPolynomial.h"
+#include "MATH/StaticModInt32.h"
+
+std::mt19937 rr;
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+using mint = OY::StaticModInt32<998244353, true>;
+using poly = OY::NTTPolynomial<mint, 1 << 22>;
+poly cdq(const poly &g, uint32_t n) {
+    poly f(n), acc(n);
+    f[0] = 1;
+    auto dfs = [&](auto self, uint32_t l, uint32_t r) -> void {
+        if (r - l == 1) {
+            if (l) f[l] = acc[l];
+            return;
+        }
+        uint32_t mid = (l + r) / 2;
+        self(self, l, mid);
+        poly a(f.begin() + l, f.begin() + mid), b(g.begin(), g.begin() + std::min<uint32_t>(g.size(), r - l));
+        poly c(poly::product(a, b, std::__bit_ceil(r - l)));
+        for (uint32_t i = mid; i < r; i++) acc[i] += c[i - l];
+        self(self, mid, r);
+    };
+    dfs(dfs, 0, n);
+    return f;
+}
+poly online(const poly &g, uint32_t n) {
+    poly f(n);
+    f[0] = 1;
+    poly::RelaxedConvolution rc(g);
+    for (uint32_t i = 0; i + 1 < n; i++) f[i + 1] = rc.push(f[i]);
+    return f;
+}
+poly offline(const poly &g, uint32_t n) {
+    poly h(n);
+    for (uint32_t i = 1; i < std::min<uint32_t>(n, g.size()); i++) h[i] = -g[i];
+    h[0] = 1;
+    return h.inv();
+}
+int main() {
+    poly::s_primitiveRoot = 3;
+    for (uint32_t len = 2; len <= 1 << 21; len *= 2) poly::prepareDFT(len);
+    for (uint32_t n : {100000, 1000000}) {
+        poly g(n);
+        for (auto &x : g) x = uint32_t(rr());
+        g[0] = 0;
+        timer_start;
+        poly a = cdq(g, n);
+        timer_end;
+        cout << "n = " << n << ": cdq " << duration_get << " ms";
+        timer_start;
+        poly b = online(g, n);
+        timer_end;
+        cout << ", RelaxedConvolution " << duration_get << " ms";
+        timer_start;
+        poly c = offline(g, n);
+        timer_end;
+        cout << ", inv " << duration_get << " ms, check " << (a == b && b == c) << endl;
+    }
+}
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2
+n = 100000: cdq 147 ms, RelaxedConvolution 117 ms, inv 26 ms, check 1
+n = 1000000: cdq 1526 ms, RelaxedConvolution 1457 ms, inv 313 ms, check 1
+
+*/
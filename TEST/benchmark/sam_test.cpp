@@ -0,0 +1,63 @@
+/*
+本文件在 C++20 标准下编译运行，比较后缀自动机各种结点在 10^7 规模输入下的构造时间与内存占用
+各内存池按实测用量取最小的二的幂，静态数组总量约 1.8 GB ，无需 -mcmodel=medium
+*/
+#include <chrono>
+#include <random>
+
+#include "IO/FastIO.h"
+#include "STR/SAM.h"
+
+static constexpr uint32_t N = 10000000, MAX_SORTED_EDGE = 1 << 25, MAX_HASH_EDGE = 1 << 26, MAX_SLOT = 1 << 26;
+std::vector<uint32_t> text;
+std::mt19937_64 rr;
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+template <typename SAM>
+void test(const char *name, uint64_t (*pool_bytes)()) {
+    uint64_t pool_before = pool_bytes();
+    timer_start;
+    SAM sam(text.begin(), text.end());
+    timer_end;
+    uint64_t node_bytes = uint64_t(sam.m_data.size()) * sizeof(typename SAM::node), pool = pool_bytes() - pool_before;
+    cout << name << ": build = " << duration_get << " ms, node = " << node_bytes / (1 << 20) << " MB, pool = " << pool / (1 << 20) << " MB, total = " << (node_bytes + pool) / (1 << 20) << " MB" << endl;
+}
+template <uint32_t ChildCount>
+void test_alphabet() {
+    text.resize(N);
+    for (auto &c : text) c = rr() % ChildCount;
+    cout << "alphabet = " << ChildCount << ", length = " << N << endl;
+    using namespace OY::SAM;
+    using Sorted = SortedNode<BaseNode, MAX_SORTED_EDGE>;
+    using Hash = HashNode<BaseNode, MAX_HASH_EDGE>;
+    using DoubleArray = DoubleArrayNode<BaseNode, ChildCount, MAX_SLOT>;
+    // 两种字母表共用 SortedNode 与 HashNode 的内存池，上一轮的自动机已析构，清空后复用
+    Sorted::s_use_count = Hash::s_use_count = 0;
+    std::fill_n(Sorted::s_free, 32, 0), std::fill_n(Hash::s_free, 32, 0);
+    test<Automaton<StaticNode<BaseNode, ChildCount>>>("StaticNode     ", [] { return uint64_t(0); });
+    test<Automaton<Sorted>>("SortedNode     ", [] { return uint64_t(Sorted::s_use_count) * 8; });
+    test<Automaton<Hash>>("HashNode       ", [] { return uint64_t(Hash::s_use_count) * 8; });
+    test<Automaton<DoubleArray>>("DoubleArrayNode", [] { return uint64_t(DoubleArray::s_use_count) * 8; });
+}
+int main() {
+    test_alphabet<4>();
+    test_alphabet<26>();
+}
+
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2
+alphabet = 4, length = 10000000
+StaticNode     : build = 4396 ms, node = 371 MB, pool = 0 MB, total = 371 MB
+SortedNode     : build = 8499 ms, node = 247 MB, pool = 203 MB, total = 451 MB
+HashNode       : build = 9802 ms, node = 247 MB, pool = 407 MB, total = 654 MB
+DoubleArrayNode: build = 9603 ms, node = 247 MB, pool = 265 MB, total = 513 MB
+alphabet = 26, length = 10000000
+StaticNode     : build = 8007 ms, node = 1390 MB, pool = 0 MB, total = 1390 MB
+SortedNode     : build = 9921 ms, node = 198 MB, pool = 222 MB, total = 421 MB
+HashNode       : build = 10201 ms, node = 198 MB, pool = 444 MB, total = 643 MB
+DoubleArrayNode: build = 20658 ms, node = 198 MB, pool = 425 MB, total = 624 MB
+
+*/
\ No newline at end of file
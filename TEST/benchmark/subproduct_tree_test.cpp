@@ -0,0 +1,60 @@
+/*
+本文件在 C++20 标准下编译运行，比较 NTTPolynomial 每次重建子积树与复用 SubproductTree 进行多点求值、快速插值的耗时
+*/
+#include <chrono>
+#include <random>
+
+#include "IO/FastIO.h"
+#include "MATH/NTTPolynomial.h"
+#include "MATH/StaticModInt32.h"
+
+std::mt19937 rr;
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+using mint = OY::StaticModInt32<998244353, true>;
+using poly = OY::NTTPolynomial<mint, 1 << 21>;
+int main() {
+    poly::s_primitiveRoot = 3;
+    for (uint32_t n : {100000, 1000000}) {
+        poly xs(n), ys(n), f(n);
+        for (uint32_t i = 0; i < n; i++) xs[i] = mint(i + 1) * mint(2654435761u);
+        for (auto &x : ys) x = uint32_t(rr());
+        for (auto &x : f) x = uint32_t(rr());
+        timer_start;
+        poly v1 = f.calc(xs), v2 = f.calc(xs);
+        timer_end;
+        cout << "n = " << n << ": calc x2 " << duration_get << " ms";
+        timer_start;
+        poly p1 = poly::fromPoints(xs, ys), p2 = poly::fromPoints(xs, v1);
+        timer_end;
+        cout << ", fromPoints x2 " << duration_get << " ms, check " << (p2 == f) << ' ' << (v1 == v2) << endl;
+        timer_start;
+        poly::SubproductTree tree(xs);
+        timer_end;
+        cout << "    SubproductTree: build " << duration_get << " ms";
+        timer_start;
+        poly w1 = tree.calc(f), w2 = tree.calc(ys);
+        timer_end;
+        cout << ", calc x2 " << duration_get << " ms";
+        timer_start;
+        poly q1 = tree.interpolate(w1), q2 = tree.interpolate(w2);
+        timer_end;
+        cout << ", interpolate x2 " << duration_get << " ms, check " << (q1 == f) << ' ' << (q2 == ys) << ' ' << (w1 == v1) << endl;
+    }
+}
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2
+修改前（子积树存放在全局缓冲区中，每次调用都重建）：
+n = 100000: calc x2 543 ms, fromPoints x2 810 ms, check 1 1
+n = 1000000: calc x2 6822 ms, fromPoints x2 10213 ms, check 1 1
+
+修改后：
+n = 100000: calc x2 878 ms, fromPoints x2 1055 ms, check 1 1
+    SubproductTree: build 111 ms, calc x2 281 ms, interpolate x2 341 ms, check 1 1 1
+n = 1000000: calc x2 8244 ms, fromPoints x2 9435 ms, check 1 1
+    SubproductTree: build 1398 ms, calc x2 4824 ms, interpolate x2 5198 ms, check 1 1 1
+
+*/
@@ -0,0 +1,42 @@
+/*
+本文件在 C++20 标准下编译运行，比较静态缓冲区与运行时缓冲区两种后缀数组在不同线程数下的构造吞吐量
+编译时需要加上 -pthread
+*/
+#include <chrono>
+#include <random>
+
+#include "IO/FastIO.h"
+#include "STR/SuffixArray.h"
+
+static constexpr uint32_t N = 1 << 24;
+std::string text;
+std::mt19937_64 rr;
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+#define throughput_get (double(N) / (1 << 20) / std::chrono::duration<double>(t1 - t0).count())
+#define test_suffix_array(Rank, Height, MAX_LEN, ThreadNum)                                                                                                                                    \
+    {                                                                                                                                                                                          \
+        timer_start;                                                                                                                                                                           \
+        OY::SA::SuffixArray<Rank, Height, MAX_LEN, ThreadNum> S(text.begin(), text.end(), 128);                                                                                              \
+        timer_end;                                                                                                                                                                             \
+        cout << "MAX_LEN = " << #MAX_LEN << ", Rank = " << #Rank << ", Height = " << #Height << ", threads = " << ThreadNum << ": " << duration_get << " ms, " << throughput_get << " MB/s" << endl; \
+    }
+int main() {
+    // 模拟基因序列：字符集为 ACGT ，并带有较长的重复片段
+    text.resize(N);
+    for (uint32_t i = 0; i < N; i++) text[i] = "ACGT"[rr() % 4];
+    for (uint32_t i = 0; i < N / 4096; i++) {
+        uint32_t from = rr() % (N - 4096), to = rr() % (N - 4096), len = rr() % 4096;
+        std::copy_n(text.begin() + from, len, text.begin() + to);
+    }
+
+    test_suffix_array(false, false, N, 1);
+    test_suffix_array(false, false, 0, 1);
+    test_suffix_array(true, true, N, 1);
+    test_suffix_array(true, true, 0, 1);
+    test_suffix_array(true, true, 0, 2);
+    test_suffix_array(true, true, 0, 4);
+    test_suffix_array(true, true, 0, 8);
+}
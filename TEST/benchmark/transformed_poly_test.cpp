@@ -0,0 +1,65 @@
+/*
+本文件在 C++20 标准下编译运行，比较 NTTPolynomial 反复乘同一个多项式时，每次重新变换与使用 TransformedPolynomial 缓存变换结果的耗时
+*/
+#include <chrono>
+#include <random>
+
+#include "IO/FastIO.h"
+#include "MATH/NTTPolynomial.h"
+#include "MATH/StaticModInt32.h"
+
+std::mt19937 rr;
+std::chrono::high_resolution_clock::time_point t0, t1;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+using mint = OY::StaticModInt32<998244353, true>;
+using poly = OY::NTTPolynomial<mint, 1 << 22>;
+poly random_poly(uint32_t n) {
+    poly a(n);
+    for (auto &x : a) x = uint32_t(rr());
+    return a;
+}
+void test_batch(uint32_t n, uint32_t rounds) {
+    poly kernel = random_poly(n);
+    std::vector<poly> as(rounds);
+    for (auto &a : as) a = random_poly(n);
+    mint sum1 = 0, sum2 = 0;
+    timer_start;
+    for (auto &a : as) sum1 += poly::product(a, kernel, n * 2)[n];
+    timer_end;
+    cout << "n = " << n << ", " << rounds << " rounds: product " << duration_get << " ms";
+    timer_start;
+    poly::TransformedPolynomial tk(kernel, n * 2);
+    for (auto &a : as) sum2 += poly::product(a, tk)[n];
+    timer_end;
+    cout << ", TransformedPolynomial " << duration_get << " ms, check " << (sum1 == sum2) << endl;
+}
+void test_long(uint32_t n, uint32_t m) {
+    poly a = random_poly(n), kernel = random_poly(m);
+    timer_start;
+    poly res1 = a * kernel;
+    timer_end;
+    cout << "n = " << n << ", m = " << m << ": a * kernel " << duration_get << " ms";
+    timer_start;
+    poly res2 = a * poly::TransformedPolynomial(kernel, std::__bit_ceil(m * 4));
+    timer_end;
+    cout << ", a * TransformedPolynomial(kernel, " << std::__bit_ceil(m * 4) << ") " << duration_get << " ms, check " << (res1 == res2) << endl;
+}
+int main() {
+    poly::s_primitiveRoot = 3;
+    for (uint32_t len = 2; len <= 1 << 21; len *= 2) poly::prepareDFT(len);
+    test_batch(1 << 10, 10000);
+    test_batch(1 << 14, 1000);
+    test_long(1 << 20, 1000);
+    test_long(1 << 20, 30000);
+}
+/*
+gcc version 12.2.0
+g++ -std=c++20 -DOY_LOCAL -O2
+n = 1024, 10000 rounds: product 1773 ms, TransformedPolynomial 1146 ms, check 1
+n = 16384, 1000 rounds: product 3685 ms, TransformedPolynomial 1612 ms, check 1
+n = 1048576, m = 1000: a * kernel 319 ms, a * TransformedPolynomial(kernel, 4096) 88 ms, check 1
+n = 1048576, m = 30000: a * kernel 372 ms, a * TransformedPolynomial(kernel, 131072) 135 ms, check 1
+
+*/
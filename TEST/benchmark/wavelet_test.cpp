@@ -0,0 +1,68 @@
+/*
+本文件在 C++20 标准下编译运行，测试小波表与动态小波表在 10^7 规模下的初始化、查询、修改延迟
+*/
+#include <chrono>
+#include <random>
+
+#include "DS/DynamicWaveLet.h"
+#include "DS/WaveLet.h"
+#include "IO/FastIO.h"
+
+static constexpr uint32_t N = 10000000, alpha = 20, M = 1000000, K = 10;
+uint32_t array[N], query[M][3];
+std::mt19937_64 rr;
+std::chrono::high_resolution_clock::time_point t0, t1;
+uint64_t sum;
+#define timer_start t0 = std::chrono::high_resolution_clock::now()
+#define timer_end t1 = std::chrono::high_resolution_clock::now()
+#define duration_get std::chrono::duration_cast<std::chrono::milliseconds>(t1 - t0).count()
+#define latency_get std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count() / M
+using Table = OY::WaveLet::Table<uint32_t, uint64_t, (N >> 6) * alpha + 2 * alpha>;
+using DynamicTable = OY::DynamicWaveLet::Table<uint32_t>;
+int main() {
+    // 值域服从偏斜分布，使得前 k 多的元素有意义
+    for (uint32_t i = 0; i < N; i++) array[i] = (rr() % (1 << alpha)) >> (rr() % alpha);
+    for (uint32_t i = 0; i < M; i++) {
+        query[i][0] = rr() % N, query[i][1] = rr() % N, query[i][2] = rr() % (1 << alpha);
+        if (query[i][0] > query[i][1]) std::swap(query[i][0], query[i][1]);
+    }
+
+    timer_start;
+    Table S(array, array + N, alpha);
+    timer_end;
+    cout << "Table's init = " << duration_get << " ms" << endl;
+
+    sum = 0;
+    timer_start;
+    for (uint32_t i = 0; i < M; i++) sum += S.quantile(query[i][0], query[i][1], (query[i][1] - query[i][0]) / 2);
+    timer_end;
+    cout << "Table's quantile = " << latency_get << " ns/op, sum = " << sum << endl;
+
+    sum = 0;
+    timer_start;
+    for (uint32_t i = 0; i < M; i++) S.do_for_top_k(query[i][0], query[i][1], K, [&](uint32_t val, uint32_t freq) { sum += val ^ freq; });
+    timer_end;
+    cout << "Table's top " << K << " = " << latency_get << " ns/op, sum = " << sum << endl;
+
+    timer_start;
+    DynamicTable D(array, array + N, alpha);
+    timer_end;
+    cout << "DynamicTable's init = " << duration_get << " ms" << endl;
+
+    sum = 0;
+    timer_start;
+    for (uint32_t i = 0; i < M; i++) sum += D.quantile(query[i][0], query[i][1], (query[i][1] - query[i][0]) / 2);
+    timer_end;
+    cout << "DynamicTable's quantile = " << latency_get << " ns/op, sum = " << sum << endl;
+
+    timer_start;
+    for (uint32_t i = 0; i < M; i++) D.modify(query[i][0], query[i][2]);
+    timer_end;
+    cout << "DynamicTable's modify = " << latency_get << " ns/op" << endl;
+
+    sum = 0;
+    timer_start;
+    for (uint32_t i = 0; i < M; i++) sum += D.get(query[i][1]);
+    timer_end;
+    cout << "DynamicTable's get = " << latency_get << " ns/op, sum = " << sum << endl;
+}
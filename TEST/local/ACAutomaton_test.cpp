@@ -58,9 +58,49 @@ void test_find_count() {
         cout << p[i] << " appear " << ac.get_node(ins_pos[i])->m_size << " times\n";
     }
 }
+void test_batch() {
+    std::string p[] = {"ab", "abca", "bc", "a", "b", "c", "d", "ca"};
+    std::vector<std::string> texts{"abcaab", "dcba", "bcd", "aaaa"};
+    using AC = OY::AC::Automaton<Node_with_index, 26>;
+    AC ac;
+    for (uint32_t i = 0; i < 8; i++) ac.get_node(ac.insert_lower(p[i]))->m_index = i;
+    ac.prepare();
+    // 文本串较多时，可以让多个文本串交错地在自动机上行走，以掩盖访存延迟
+    // 对于每个文本串，回调按照字符的顺序进行
+    std::vector<uint32_t> cnt(texts.size());
+    ac.do_for_each_batch(texts.begin(), texts.end(), [](char c) { return c - 'a'; }, [&](uint32_t i, uint32_t x) {
+        for (; x; x = ac.query_fail(x))
+            if (~ac.get_node(x)->m_index) cnt[i]++;
+    });
+    for (uint32_t i = 0; i < texts.size(); i++) cout << texts[i] << " contains " << cnt[i] << " patterns\n";
+}
+void test_compact() {
+    std::string p[] = {"ab", "abca", "bc", "a", "b", "c", "d", "ca"};
+    std::string s = "abcaabcaab";
+    // 字典很大时，可以使用紧凑版本，接口与普通版本一致
+    using AC = OY::AC::CompactAutomaton<Node_with_cnt, 26>;
+    AC ac;
+    int ins_pos[8];
+    for (uint32_t i = 0; i < 8; i++) {
+        ins_pos[i] = ac.insert_lower(p[i]);
+    }
+    ac.prepare();
+    // 只在匹配到的结点处加一，最后沿失配指针把次数累加上去
+    uint32_t pos = 0;
+    for (char c : s) {
+        pos = ac.next(pos, c - 'a');
+        ac.get_node(pos)->m_size++;
+    }
+    ac.do_for_failing_nodes([&](uint32_t x) { ac.get_fail_node(x)->m_size += ac.get_node(x)->m_size; });
+    for (uint32_t i = 0; i < 8; i++) {
+        cout << p[i] << " appear " << ac.get_node(ins_pos[i])->m_size << " times\n";
+    }
+}
 int main() {
     test_find_index();
     test_find_count();
+    test_batch();
+    test_compact();
 }
 /*
 #输出如下
@@ -111,5 +151,17 @@ b appear 3 times
 c appear 2 times
 d appear 0 times
 ca appear 2 times
+abcaab contains 11 patterns
+dcba contains 4 patterns
+bcd contains 4 patterns
+aaaa contains 4 patterns
+ab appear 3 times
+abca appear 2 times
+bc appear 2 times
+a appear 5 times
+b appear 3 times
+c appear 2 times
+d appear 0 times
+ca appear 2 times
 
 */
\ No newline at end of file
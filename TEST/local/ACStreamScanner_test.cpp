@@ -0,0 +1,52 @@
+#include "IO/FastIO.h"
+#include "STR/ACAutomaton.h"
+#include "STR/ACStreamScanner.h"
+
+struct Node {
+    uint32_t m_index = -1, m_output = -1;
+};
+int main() {
+    std::string p[] = {"ab", "abca", "bc", "d", "ca"};
+    std::string s = "abcaabcaabdca";
+    using AC = OY::AC::CompactAutomaton<Node, 26>;
+    AC ac;
+    uint32_t max_len = 0;
+    for (uint32_t i = 0; i < 5; i++) {
+        ac.get_node(ac.insert_lower(p[i]))->m_index = i;
+        max_len = std::max<uint32_t>(max_len, p[i].size());
+    }
+    ac.prepare();
+    // 预处理出每个结点沿失配指针能到达的第一个模式串结点
+    ac.do_for_extending_nodes([&](uint32_t x) {
+        auto p = ac.get_node(x);
+        p->m_output = ~p->m_index ? x : ac.get_fail_node(x)->m_output;
+    });
+
+    // 为了演示，把每个线程处理的块设得很小
+    OY::ACStreamScanner<AC, 4, 2> scanner(ac, max_len);
+    auto map = [](char c) { return c - 'a'; };
+    auto judge = [&](uint32_t x) { return ~ac.get_node(x)->m_output; };
+    auto call = [&](uint64_t pos, uint32_t x) {
+        cout << "at position " << pos << ':';
+        for (x = ac.get_node(x)->m_output; ~x; x = ac.get_fail_node(x)->m_output) cout << ' ' << p[ac.get_node(x)->m_index];
+        cout << endl;
+    };
+    // 文本可以分多次送入，扫描器会接着上次的状态继续匹配
+    scanner.scan(s.data(), s.data() + 6, map, judge, call);
+    scanner.scan(s.data() + 6, s.data() + s.size(), map, judge, call);
+    cout << "scanned " << scanner.offset() << " chars\n";
+}
+/*
+#输出如下
+at position 1: ab
+at position 2: bc
+at position 3: abca ca
+at position 5: ab
+at position 6: bc
+at position 7: abca ca
+at position 9: ab
+at position 10: d
+at position 12: ca
+scanned 13 chars
+
+*/
\ No newline at end of file
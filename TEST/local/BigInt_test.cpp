@@ -0,0 +1,131 @@
+#include "IO/FastIO.h"
+#include "MATH/BigInt.h"
+
+int main() {
+    using bint = OY::BigInt<>;
+    // 无参构造为零
+    bint zero;
+    cout << "zero : " << zero << endl;
+    // 可以从 int/long long 等构造
+    bint one(1ll);
+    cout << "one : " << one << endl;
+    // 可以从 int128 构造
+    bint a(__int128_t(123456789987654321));
+    cout << "a : " << a << endl;
+    // 可以从常量字符串或者 std::string 构造
+    bint b("112233445566778899998877665544332211");
+    cout << "b : " << b << endl;
+    // 可以拷贝
+    bint c(b);
+    cout << "c : " << c << endl;
+
+    // 生成 5 个位长为 7 的大数
+    std::vector<bint> some(5);
+    for (int i = 0; i < 5; i++) some[i] = bint::rand(7);
+    for (int i = 0; i < 5; i++) cout << "some[" << i << "] = " << some[i] << endl;
+
+    // 比较绝对值大小
+    bint d(12345), e(-123456);
+    auto comp_res = bint::absCompare(d, e);
+    if (comp_res == 1)
+        cout << "abs(" << d << ") > abs(" << e << ")" << endl;
+    else if (comp_res == 0)
+        cout << "abs(" << d << ") = abs(" << e << ")" << endl;
+    else
+        cout << "abs(" << d << ") < abs(" << e << ")" << endl;
+
+    // 带余除法
+    auto [q1, r1] = bint::div_mod<true>(a, d);
+    cout << a << " / " << d << " = " << q1 << " , rem = " << r1 << endl;
+
+    // 除数为 long long 的情况下
+    long long f = 12345;
+    auto [q2, r2] = bint::div_mod(a, f);
+    cout << a << " / " << f << " = " << q2 << " , rem = " << r2 << endl;
+
+    // 变为相反数
+    cout << "d = " << d << endl;
+    d.opposite();
+    cout << "after opposite, d = " << d << endl;
+
+    // 改变符号
+    d.setSign(false);
+    cout << "after setSign, d = " << d << endl;
+
+    // 取位长
+    auto len = a.length();
+    cout << "length of " << a << " is " << len << endl;
+
+    // 幂运算
+    auto pow = a.pow(3);
+    cout << a << "^3 = " << pow << endl;
+
+    // 开根运算
+    auto sqrt = pow.sqrt(6);
+    cout << pow << "^(1/3) = " << sqrt << endl;
+
+    // 强转为 bool
+    if (zero)
+        cout << zero << " is true\n";
+    else
+        cout << zero << " is false\n";
+    if (one)
+        cout << one << " is true\n";
+    else
+        cout << one << " is false\n";
+
+    // 强转为 int
+    int g(some[0]);
+    cout << "g = " << g << endl;
+
+    // 转换为 string
+    std::string s(some[0]);
+    cout << "s = " << s << endl;
+
+    // 在内存池中计算表达式，临时变量不会申请堆空间
+    std::vector<int> pool(1 << 10);
+    bint x;
+    for (int i = 0; i < 3; i++) {
+        bint::Arena arena(pool.data(), pool.size());
+        x = a * b + c * d - x;
+    }
+    cout << "x = " << x << endl;
+
+    // 在内存池作用域内对外部大数做复合运算，扩容的空间来自堆，作用域结束后仍然有效
+    bint y(1);
+    {
+        bint::Arena arena(1 << 12);
+        bint z("123456789012345678901234567890");
+        y += z, y *= z, y <<= 5, ++y;
+    }
+    cout << "y = " << y << endl;
+}
+/*
+#输出如下
+zero : 0
+one : 1
+a : 123456789987654321
+b : 112233445566778899998877665544332211
+c : 112233445566778899998877665544332211
+some[0] = 7211612
+some[1] = 6346734
+some[2] = 2404204
+some[3] = 9919429
+some[4] = 8962298
+abs(12345) < abs(-123456)
+123456789987654321 / 12345 = 10000550019251 , rem = 726
+123456789987654321 / 12345 = 10000550019251 , rem = 726
+d = 12345
+after opposite, d = -12345
+after setSign, d = 12345
+length of 123456789987654321 is 18
+123456789987654321^3 = 1881676416949388556641282847971835068037656108518161
+1881676416949388556641282847971835068037656108518161^(1/3) = 351364184
+0 is false
+1 is true
+g = 7211612
+s = 7211612
+x = 13855980918930041063446536712958099589364149034778526
+y = 1524157875323883675049535156265965557651425087877625361999000001
+
+*/
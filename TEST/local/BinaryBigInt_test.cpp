@@ -0,0 +1,41 @@
+#include "IO/FastIO.h"
+#include "MATH/BinaryBigInt.h"
+
+int main() {
+    OY::BinaryBigInt a("123456789012345678901234567890"), b(-987654321);
+    cout << "a + b = " << a + b << endl;
+    cout << "a - b = " << a - b << endl;
+    cout << "a * b = " << a * b << endl;
+    cout << "a / b = " << a / b << endl;
+    cout << "a % b = " << a % b << endl;
+
+    // 移位按二进制进行
+    OY::BinaryBigInt p = OY::BinaryBigInt(1) << 200;
+    cout << "2^200 = " << p << endl;
+    cout << "bit_width(2^200 - 1) = " << (p - 1).bit_width() << endl;
+
+    OY::BinaryBigInt fac = 1;
+    for (int i = 1; i <= 50; i++) fac *= i;
+    cout << "50! = " << fac << endl;
+
+    // 大规模乘法会自动切换到 Karatsuba/Toom-3/NTT
+    std::string s(100000, '9');
+    OY::BinaryBigInt x(s), y = x * x;
+    std::string t = y.to_string();
+    cout << "(10^100000 - 1)^2 has " << t.size() << " digits, head = " << t.substr(0, 10) << ", tail = " << t.substr(t.size() - 10) << endl;
+    cout << "check: " << (y / x == x) << endl;
+}
+/*
+#输出如下
+a + b = 123456789012345678900246913569
+a - b = 123456789012345678902222222211
+a * b = -121932631124828532112482853211126352690
+a / b = -124999998873437499901
+a % b = 574845669
+2^200 = 1606938044258990275541962092341162602522202993782792835301376
+bit_width(2^200 - 1) = 200
+50! = 30414093201713378043612608166064768844377641568960512000000000000
+(10^100000 - 1)^2 has 200000 digits, head = 9999999999, tail = 0000000001
+check: 1
+
+*/
\ No newline at end of file
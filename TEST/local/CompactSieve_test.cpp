@@ -0,0 +1,46 @@
+#include "IO/FastIO.h"
+#include "MATH/CompactSieve.h"
+
+int main() {
+    // 只记录最小质因数，每个数平均占用约 0.53 字节
+    OY::CompactSieve::Sieve<> ps(100000000);
+    cout << "1234567 is prime?" << (ps.is_prime(1234567) ? "yes\n" : "no\n");
+    cout << "1234577 is prime?" << (ps.is_prime(1234577) ? "yes\n" : "no\n");
+
+    cout << "smallest prime factor of 99999989: " << ps.query_smallest_factor(99999989) << endl;
+    cout << "smallest prime factor of 1234567: " << ps.query_smallest_factor(1234567) << endl;
+    cout << "biggest prime factor of 1234567: " << ps.query_biggest_factor(1234567) << endl;
+    cout << "phi of 1234567: " << ps.get_Euler_Phi(1234567) << endl;
+
+    uint32_t A = 2 * 3 * 3 * 5 * 5 * 97 * 101;
+    auto pf = ps.decomposite(A);
+    for (auto [p, c] : pf) {
+        cout << p << '^' << c << endl;
+    }
+
+    uint32_t B = 2 * 3 * 5 * 7;
+    auto fs = ps.get_factors<true>(B);
+    for (auto f : fs) cout << f << ' ';
+    cout << endl;
+
+    // 多线程打表
+    OY::CompactSieve::Sieve<4> ps4(100000000);
+    cout << "smallest prime factor of 99999999: " << ps4.query_smallest_factor(99999999) << endl;
+}
+/*
+#输出如下
+1234567 is prime?no
+1234577 is prime?yes
+smallest prime factor of 99999989: 99999989
+smallest prime factor of 1234567: 127
+biggest prime factor of 1234567: 9721
+phi of 1234567: 1224720
+2^1
+3^2
+5^2
+97^1
+101^1
+1 2 3 5 6 7 10 14 15 21 30 35 42 70 105 210 
+smallest prime factor of 99999999: 3
+
+*/
@@ -51,6 +51,16 @@ int main() {
     cout << "fibonacci[10] = " << (init * P.pow(10))[0][0] << endl;
     // 计算 a[100000000000000]%1000000007
     cout << "fibonacci[100000000000000] = " << (init * P.pow(100000000000000))[0][0] << endl;
+
+    // 小模数、内维超过分块深度时的乘法
+    using small = OY::StaticModInt32<257, true>;
+    auto X = OY::DynamicMatrix<small>::raw(300, 300), Y = OY::DynamicMatrix<small>::raw(300, 300);
+    for (int i = 0; i < 300; i++)
+        for (int j = 0; j < 300; j++) X[i][j] = i * 7 + j, Y[i][j] = i + j * 3;
+    auto Z = X * Y;
+    small brute = 0;
+    for (int k = 0; k < 300; k++) brute += X[299][k] * Y[k][299];
+    cout << "Z[299][299] = " << Z[299][299] << ", brute = " << brute << endl;
 }
 /*
 #输出如下
@@ -75,5 +85,6 @@ fibonacci[0] = 1
 fibonacci[1] = 1
 fibonacci[10] = 89
 fibonacci[100000000000000] = 481075011
+Z[299][299] = 76, brute = 76
 
 */
\ No newline at end of file
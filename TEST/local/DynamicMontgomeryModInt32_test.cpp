@@ -2,6 +2,8 @@
 #include "MATH/DynamicMontgomeryModInt32.h"
 
 #include <random>
+#include <thread>
+#include <vector>
 
 void test_Fermat_10000019() {
     // 验证费马定理
@@ -45,10 +47,45 @@ void test_big_modint() {
     cout << "prod from " << start << " to " << start + len - 1 << " mod " << mint::mod() << " = " << prod << endl;
 }
 
+void test_context_and_batch() {
+    // 在两个模数之间切换，并做批量运算
+    using mint = OY::DynamicMontgomeryModInt32<3>;
+    mint::set_mod(998244353, true);
+    mint a[5], inv[5];
+    for (int i = 0; i != 5; i++) a[i] = i + 2;
+    mint::pow_batch(a, mint::mod() - 2, inv, 5);
+    for (int i = 0; i != 5; i++) cout << a[i] << " * " << inv[i] << " = " << a[i] * inv[i] << " mod " << mint::mod() << endl;
+    {
+        mint::context_guard guard(mint::context_type(1000000007, true));
+        mint b[5], c[5];
+        for (int i = 0; i != 5; i++) b[i] = i + 2;
+        mint::mul_batch(b, b, c, 5);
+        for (int i = 0; i != 5; i++) cout << b[i] << "^2 = " << c[i] << " mod " << mint::mod() << endl;
+    }
+    cout << "mod restored to " << mint::mod() << endl;
+
+    // 每个线程使用自己的模数
+    using tmint = OY::DynamicMontgomeryModInt32<4, true>;
+    uint32_t mods[3] = {998244353, 1000000007, 1000000009}, res[3];
+    std::vector<std::thread> threads;
+    for (int i = 0; i != 3; i++)
+        threads.emplace_back([&, i] {
+            tmint::set_mod(mods[i], true);
+            tmint a[100], sum = 0;
+            for (int j = 0; j != 100; j++) a[j] = j + 1;
+            tmint::pow_batch(a, mods[i] - 2, a, 100);
+            for (int j = 0; j != 100; j++) sum += a[j];
+            res[i] = sum.val();
+        });
+    for (auto &t : threads) t.join();
+    for (int i = 0; i != 3; i++) cout << "sum of 1/i for i in [1, 100] mod " << mods[i] << " = " << res[i] << endl;
+}
+
 int main() {
     test_Fermat_10000019();
     test_small_modint();
     test_big_modint();
+    test_context_and_batch();
 }
 /*
 #输出如下
@@ -56,5 +93,19 @@ int main() {
 sum from 124402445990 to 124412445990 = 1244074584307445990
 sum from 124402445990 to 124412445990 mod 75 = 65
 prod from 14514284786278117030 to 14514284786288117030 mod 1000000007 = 495331658
+2 * 499122177 = 1 mod 998244353
+3 * 332748118 = 1 mod 998244353
+4 * 748683265 = 1 mod 998244353
+5 * 598946612 = 1 mod 998244353
+6 * 166374059 = 1 mod 998244353
+2^2 = 4 mod 1000000007
+3^2 = 9 mod 1000000007
+4^2 = 16 mod 1000000007
+5^2 = 25 mod 1000000007
+6^2 = 36 mod 1000000007
+mod restored to 998244353
+sum of 1/i for i in [1, 100] mod 998244353 = 520789126
+sum of 1/i for i in [1, 100] mod 1000000007 = 632742311
+sum of 1/i for i in [1, 100] mod 1000000009 = 932837444
 
 */
\ No newline at end of file
@@ -0,0 +1,58 @@
+#include "DS/DynamicWaveLet.h"
+#include "IO/FastIO.h"
+
+int main() {
+    // 先给出一个长度为 10 的区间
+    uint32_t A[10] = {1, 5, 6, 3, 8, 4, 4, 2, 10, 1};
+    for (int i = 0; i < 10; i++) cout << A[i] << (i == 9 ? '\n' : ' ');
+
+    // 建立一个值域位宽为 4 的动态小波表
+    auto wt = OY::DynamicWaveLetTable<uint32_t>(A, A + 10, 4);
+
+    // 区间第 k
+    cout << "A[3~6] No.1 = " << wt.quantile(3, 6, 0) << endl;
+    cout << "A[3~6] No.2 = " << wt.quantile(3, 6, 1) << endl;
+    cout << "A[3~6] No.3 = " << wt.quantile(3, 6, 2) << endl;
+    cout << "A[3~6] No.4 = " << wt.quantile(3, 6, 3) << endl;
+
+    // 单点修改
+    wt.modify(4, 3);
+    wt.modify(5, 7);
+    cout << "after modify:";
+    for (int i = 0; i < 10; i++) cout << ' ' << wt.get(i);
+    cout << endl;
+
+    // 区间值域统计个数
+    cout << "A[0~6].count(3) = " << wt.count(0, 6, 3) << endl;
+    cout << "A[0~6].count(1~4) = " << wt.count(0, 6, 1, 4) << endl;
+
+    // 区间排名
+    cout << "A[3~6] rank of (4) = " << wt.rank(3, 6, 4) << endl;
+    cout << "A[3~6] rank of (5) = " << wt.rank(3, 6, 5) << endl;
+
+    // 区间最小值
+    cout << "A[3~6] minimum = " << wt.minimum(3, 6) << endl;
+
+    // 区间最大值
+    cout << "A[3~6] maximum = " << wt.maximum(3, 6) << endl;
+
+    // 区间第 k
+    cout << "A[3~6] No.2 = " << wt.quantile(3, 6, 1) << endl;
+}
+/*
+#输出如下
+1 5 6 3 8 4 4 2 10 1
+A[3~6] No.1 = 3
+A[3~6] No.2 = 4
+A[3~6] No.3 = 4
+A[3~6] No.4 = 8
+after modify: 1 5 6 3 3 7 4 2 10 1
+A[0~6].count(3) = 2
+A[0~6].count(1~4) = 4
+A[3~6] rank of (4) = 2
+A[3~6] rank of (5) = 3
+A[3~6] minimum = 3
+A[3~6] maximum = 7
+A[3~6] No.2 = 3
+
+*/
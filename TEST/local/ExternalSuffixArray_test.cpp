@@ -0,0 +1,37 @@
+#include "IO/FastIO.h"
+#include "STR/ExternalSuffixArray.h"
+
+int main() {
+    // 先把文本写入文件
+    std::string s = "abcabaaabca";
+    FILE *fp = fopen("text.bin", "wb");
+    fwrite(s.data(), 1, s.size(), fp);
+    fclose(fp);
+
+    {
+        // 以 1MB 内存限制建立外存后缀数组，结果写入 sa_out.sa 与 sa_out.height
+        OY::EXTSA::SuffixArray<true> SA("text.bin", "sa_out", 1 << 20);
+
+        // 按照字典序枚举后缀子串，且查询其与前一个串的最长公共前缀长度
+        for (int i = 0; i < SA.size(); i++)
+            cout << s.substr(SA.query_sa(i)) << ' ' << SA.query_height(i) << endl;
+    }
+
+    // 析构后删除文本与输出文件
+    remove("text.bin"), remove("sa_out.sa"), remove("sa_out.height");
+}
+/*
+#输出如下
+a 0
+aaabca 1
+aabca 2
+abaaabca 1
+abca 2
+abcabaaabca 4
+baaabca 0
+bca 1
+bcabaaabca 3
+ca 0
+cabaaabca 2
+
+*/
@@ -0,0 +1,39 @@
+#include "IO/FastIO.h"
+#include "STR/FMIndex.h"
+#include "STR/SuffixArray.h"
+
+int main() {
+    std::string s = "abcabaaabca";
+    // 先建立后缀数组，再从后缀数组建立 FM 索引
+    OY::SA::SuffixArray<false, false, 1000> SA(s);
+    OY::FMIndex<4, 1000> fm(s.begin(), s.end(), SA);
+
+    // 查询模式串出现次数
+    for (std::string p : {"a", "ab", "abc", "ca", "aab", "cc"}) cout << p << " occurs " << fm.count(p) << " times" << endl;
+
+    // 查询模式串出现位置（按照后缀字典序）
+    cout << "positions of \"ab\":";
+    fm.do_for_each_occurrence(std::string("ab"), [](uint32_t pos) { cout << ' ' << pos; });
+    cout << endl;
+
+    // 非 ASCII 文本按无符号字节处理，后缀数组也须按无符号字节建立
+    std::string t = "北京大学北大";
+    OY::SA::SuffixArray<false, false, 1000> SA2(t.size(), [&](uint32_t i) { return uint8_t(t[i]); });
+    OY::FMIndex<4, 1000> fm2(t.begin(), t.end(), SA2);
+    for (std::string p : {"北", "北大", "大学", "清华"}) cout << p << " occurs " << fm2.count(p) << " times" << endl;
+}
+/*
+#输出如下
+a occurs 6 times
+ab occurs 3 times
+abc occurs 2 times
+ca occurs 2 times
+aab occurs 1 times
+cc occurs 0 times
+positions of "ab": 3 7 0
+北 occurs 2 times
+北大 occurs 1 times
+大学 occurs 1 times
+清华 occurs 0 times
+
+*/
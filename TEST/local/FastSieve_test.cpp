@@ -17,6 +17,13 @@ int main() {
     auto B = ps.to_bitset();
     cout << "1234567 is prime?" << (B[1234567] ? "yes" : "no") << endl;
     cout << "123457 is prime?" << (B[123457] ? "yes" : "no") << endl;
+
+    // 分段筛可以处理很靠后的区间，且不需要打表
+    OY::SIEVE::SegmentedSieve<> seg;
+    cout << "number of primes in [1000000000000, 1000001000000): " << seg.count(1000000000000, 1000001000000) << endl;
+    cout << "primes in [1000000000000, 1000000000100):";
+    seg.enumerate(1000000000000, 1000000000100, [](uint64_t p) { cout << ' ' << p; });
+    cout << endl;
 }
 /*
 #输出如下
@@ -29,5 +36,7 @@ No.4 prime is: 11
 No.5000000 prime is: 86028157
 1234567 is prime?no
 123457 is prime?yes
+number of primes in [1000000000000, 1000001000000): 36249
+primes in [1000000000000, 1000000000100): 1000000000039 1000000000061 1000000000063 1000000000091
 
 */
\ No newline at end of file
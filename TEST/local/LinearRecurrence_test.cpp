@@ -0,0 +1,35 @@
+#include "IO/FastIO.h"
+#include "MATH/LinearRecurrence.h"
+#include "MATH/StaticModInt32.h"
+
+using mint = OY::StaticModInt32<998244353, true>;
+using poly = OY::NTTPolynomial<mint, 1 << 10>;
+int main() {
+    poly::s_primitiveRoot = 3;
+
+    // 斐波那契数列 a_i = a_i-1 + a_i-2
+    OY::LinearRecurrence<poly> fib(poly{0, 1}, poly{1, 1});
+    cout << "fib[10] = " << fib.query(10) << endl;
+    cout << "fib[1000000000000000000] = " << fib.query(1000000000000000000) << endl;
+
+    // 批量查询
+    auto res = fib.query(std::vector<uint64_t>{1, 2, 3, 4, 5, 100});
+    for (auto x : res) cout << x << ' ';
+    cout << endl;
+
+    // 由前若干项求出递推式
+    poly seq{1, 2, 4, 9, 20, 45, 101, 227, 510};
+    auto rec = OY::LinearRecurrence<poly>::fromSequence(seq);
+    cout << "order = " << rec.order() << ", weight = " << rec.weight() << endl;
+    for (uint32_t i = 0; i != 12; i++) cout << rec.query(i) << ' ';
+    cout << endl;
+}
+/*
+#输出如下
+fib[10] = 55
+fib[1000000000000000000] = 23849548
+1 1 2 3 5 494958974 
+order = 3, weight = 2 1 998244352 
+1 2 4 9 20 45 101 227 510 1146 2575 5786 
+
+*/
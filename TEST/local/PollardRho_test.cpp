@@ -13,6 +13,13 @@ int main() {
     for (auto f : fs) {
         cout << B << " % " << f << " = " << B % f << endl;
     }
+
+    // 批量分解
+    auto res = OY::PollardRho::decomposite_batch<true>({1000000007ull * 998244353, 4611686014132420609, 1ull << 62, 600851475143});
+    for (auto &&pairs : res) {
+        for (auto &&pair : pairs) cout << pair.m_prime << '^' << pair.m_count << ' ';
+        cout << endl;
+    }
 }
 /*
 #输出如下
@@ -37,5 +44,9 @@ int main() {
 210 % 70 = 0
 210 % 105 = 0
 210 % 210 = 0
+998244353^1 1000000007^1 
+2147483647^2 
+2^62 
+71^1 839^1 1471^1 6857^1 
 
 */
\ No newline at end of file
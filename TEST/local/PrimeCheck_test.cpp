@@ -7,6 +7,12 @@ int main() {
             cout << i << " is prime\n";
         }
     }
+
+    // 批量判断
+    uint64_t A[] = {998244353, 1000000007, 1000000008, 4759123141, 9223372036854775783, 9223372036854775807};
+    bool res[6];
+    OY::is_prime64_batch(A, A + 6, res);
+    for (int i = 0; i != 6; i++) cout << A[i] << (res[i] ? " is prime\n" : " is not prime\n");
 }
 /*
 #输出如下
@@ -26,5 +32,11 @@ int main() {
 1091 is prime
 1093 is prime
 1097 is prime
+998244353 is prime
+1000000007 is prime
+1000000008 is not prime
+4759123141 is not prime
+9223372036854775783 is prime
+9223372036854775807 is not prime
 
 */
\ No newline at end of file
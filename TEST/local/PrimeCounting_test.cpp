@@ -0,0 +1,29 @@
+#include "IO/FastIO.h"
+#include "MATH/PrimeCounting.h"
+#include "MATH/StaticModInt32.h"
+
+using mint = OY::StaticModInt32<998244353, true>;
+int main() {
+    // 求质数个数
+    cout << "pi(10^10) = " << OY::PRIMECOUNT::prime_count(10000000000) << endl;
+    cout << "pi(10^12) = " << OY::PRIMECOUNT::prime_count<4>(1000000000000) << endl;
+
+    // 求质数之和
+    cout << "sum of primes <= 10^10 mod 998244353 = " << OY::PRIMECOUNT::prime_sum<mint>(10000000000) << endl;
+
+    // 用两张表求 phi 的前缀和：质数处 phi(p) = p - 1
+    uint64_t n = 10000000000;
+    OY::PRIMECOUNT::LucyTable<mint> cnt(n, [](uint64_t v) { return mint(v - 1); }, [](uint32_t) { return mint(1); });
+    OY::PRIMECOUNT::LucyTable<mint> sum(n, [](uint64_t v) { return (v & 1 ? mint(v) * mint((v + 1) / 2) : mint(v / 2) * mint(v + 1)) - 1; }, [](uint32_t p) { return mint(p); });
+    auto prime_phi = [&](uint64_t v) { return sum.query(v) - cnt.query(v); };
+    auto phi = [](uint64_t p, uint32_t, uint64_t pe) { return mint(pe / p * (p - 1)); };
+    cout << "sum of phi(i) for i <= 10^10 mod 998244353 = " << OY::PRIMECOUNT::Min25_sum<mint>(n, cnt.primes(), prime_phi, phi) << endl;
+}
+/*
+#输出如下
+pi(10^10) = 455052511
+pi(10^12) = 37607912018
+sum of primes <= 10^10 mod 998244353 = 94769928
+sum of phi(i) for i <= 10^10 mod 998244353 = 866849765
+
+*/
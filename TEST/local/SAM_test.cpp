@@ -32,6 +32,16 @@ void test_substr_cnt() {
     cout << "ab appeared " << query_cnt("ab") << " times\n";
     cout << "abb appeared " << query_cnt("abb") << " times\n";
     cout << "ca appeared " << query_cnt("ca") << " times\n";
+
+    // 查询较多时，可以让多个查询交错地在自动机上行走，以掩盖访存延迟
+    // 回调的顺序是查询完成的顺序，而不是查询的下标顺序
+    std::vector<std::string> qs{"ab", "abb", "ca", "bcd", "cc"};
+    sam.query_batch(qs.begin(), qs.end(), [](char c) { return c - 'a'; }, [&](uint32_t i, uint32_t a) {
+        if (~a)
+            cout << qs[i] << " appeared " << sam.get_node(a)->m_cnt << " times\n";
+        else
+            cout << qs[i] << " never appeared\n";
+    });
     cout << endl;
 }
 
@@ -71,17 +81,43 @@ void test_map_node() {
     cout << endl;
 }
 
+template <typename SAM>
+void test_compact_node(const char *name) {
+    std::vector<int> s{9999, 1437, 9999, 1437, 1437, 9999, 1437, 9999};
+    SAM sam(s.begin(), s.end());
+    for (uint32_t i = 0; i != sam.size(); i++) sam.get_node(sam.query_node_index(i))->m_cnt = 1;
+    sam.prepare();
+    sam.do_for_failing_nodes([&](uint32_t a) {
+        uint32_t p = sam.query_fail(a);
+        if (~p) sam.get_node(p)->m_cnt += sam.get_node(a)->m_cnt;
+    });
+    uint32_t a = 0;
+    for (int c : {1437, 9999}) a = sam.get_node(a)->get_child(c);
+    cout << name << ": [1437, 9999] appeared " << sam.get_node(a)->m_cnt << " times\n";
+}
+
 int main() {
     test_substr_cnt();
     test_map_node();
+    // 字符集较大或者较稀疏时，可以使用紧凑的结点
+    test_compact_node<OY::SortedSAM<Node, 1000>>("SortedSAM");
+    test_compact_node<OY::HashSAM<Node, 1000>>("HashSAM");
 }
 /*
 #输出如下
 ab appeared 5 times
 abb appeared 2 times
 ca appeared 2 times
+ab appeared 5 times
+cc appeared 1 times
+ca appeared 2 times
+bcd never appeared
+abb appeared 2 times
 
 [1437, 9999] appeared 3 times
 [9999] appeared 4 times
 
+SortedSAM: [1437, 9999] appeared 3 times
+HashSAM: [1437, 9999] appeared 3 times
+
 */
\ No newline at end of file
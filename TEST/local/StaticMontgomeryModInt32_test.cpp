@@ -2,6 +2,7 @@
 #include "MATH/StaticMontgomeryModInt32.h"
 
 #include <random>
+#include <vector>
 
 void test_Fermat_10000019() {
     // 验证费马定理
@@ -42,10 +43,27 @@ void test_big_modint() {
     cout << "prod from " << start << " to " << start + len - 1 << " mod " << mint::mod() << " = " << prod << endl;
 }
 
+void test_vector() {
+    // 开启 AVX2 时用向量类型一次处理八个数，否则逐个处理，两者结果相同
+    using mint = OY::mgint998244353;
+    std::vector<mint> a(1000), b(1000), c(1000);
+    for (uint32_t i = 0; i != 1000; i++) a[i] = i, b[i] = i * i;
+    uint32_t i = 0;
+#ifdef __AVX2__
+    using vec = mint::vector_type;
+    for (; i + vec::lanes <= 1000; i += vec::lanes) (vec::load(a.data() + i) * vec::load(b.data() + i)).store(c.data() + i);
+#endif
+    for (; i != 1000; i++) c[i] = a[i] * b[i];
+    mint sum = 0;
+    for (auto x : c) sum += x;
+    cout << "sum of i^3 for i in [0, 1000) mod " << mint::mod() << " = " << sum << endl;
+}
+
 int main() {
     test_Fermat_10000019();
     test_small_modint();
     test_big_modint();
+    test_vector();
 }
 /*
 #输出如下
@@ -53,5 +71,6 @@ int main() {
 sum from 124402445990 to 124412445990 = 1244074584307445990
 sum from 124402445990 to 124412445990 mod 75 = 65
 prod from 14514284786278117030 to 14514284786288117030 mod 1000000007 = 495331658
+sum of i^3 for i in [0, 1000) mod 998244353 = 937406103
 
 */
\ No newline at end of file
@@ -35,6 +35,11 @@ int main() {
     // 区间最大异或
     cout << "A[3~6].max_bitxor(9) = " << wt.max_bitxor(3, 6, 9) << endl;
 
+    // 区间出现次数前 k 多的元素
+    cout << "A[0~7] top 2:";
+    wt.do_for_top_k(0, 7, 2, [](uint32_t val, uint32_t freq) { cout << " (" << val << ", " << freq << ")"; });
+    cout << endl;
+
     std::string B[] = {"hello", "app", "app", "world", "banana", "app", "banana", "hello"};
     // 建立一个默认小波树
     auto wt2 = OY::WaveLetTree<std::string, uint64_t, 1000>(B, B + 8);
@@ -63,6 +68,11 @@ int main() {
 
     // 区间最大值
     cout << "B[1~6] maximum = " << wt2.maximum(1, 6) << endl;
+
+    // 区间出现次数前 k 多的元素
+    cout << "B[1~6] top 2:";
+    wt2.do_for_top_k(1, 6, 2, [](const std::string &val, uint32_t freq) { cout << " (" << val << ", " << freq << ")"; });
+    cout << endl;
 }
 /*
 #输出如下
@@ -81,6 +91,7 @@ A[3~6] rank of (6) = 3
 A[3~6] minimum = 3
 A[3~6] maximum = 8
 A[3~6].max_bitxor(9) = 13
+A[0~7] top 2: (4, 2) (1, 1)
 B[1~6] No.1 = app
 B[1~6] No.2 = app
 B[1~6] No.3 = app
@@ -96,5 +107,6 @@ B[1~6] rank of ("apple")    = 3
 B[1~6] rank of ("banana") = 3
 B[1~6] minimum = app
 B[1~6] maximum = world
+B[1~6] top 2: (app, 3) (banana, 2)
 
 */
\ No newline at end of file
@@ -0,0 +1,34 @@
+#include "DS/DynamicWaveLet.h"
+#include "IO/FastIO.h"
+
+/*
+[P2617 Dynamic Rankings](https://www.luogu.com.cn/problem/P2617)
+*/
+/**
+ * 本题为 P3834 的带修改版本
+ * 值域在 10^9 以内，可以直接用 30 位的动态小波表，不需要离散化
+ */
+int main() {
+    uint32_t n, m;
+    cin >> n >> m;
+    auto S = OY::DynamicWaveLetTable<uint32_t>(
+        n, [](auto...) {
+            uint32_t x = 0;
+            cin >> x;
+            return x;
+        },
+        30);
+    for (uint32_t i = 0; i < m; i++) {
+        char op = 0;
+        cin >> op;
+        if (op == 'Q') {
+            uint32_t l = 0, r = 0, k = 0;
+            cin >> l >> r >> k;
+            cout << S.quantile(l - 1, r - 1, k - 1) << endl;
+        } else {
+            uint32_t x = 0, y = 0;
+            cin >> x >> y;
+            S.modify(x - 1, y);
+        }
+    }
+}
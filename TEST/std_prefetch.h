@@ -0,0 +1,27 @@
+#ifndef __OY_STD_PREFETCH__
+#define __OY_STD_PREFETCH__
+
+/*
+各编译器的预取指令写法不同，特此统一。
+交错推进多条查询的模板用它提前把下一步要访问的结点读入缓存；
+如果提交 oj 时用到了依赖本头文件的模板，那你可以把本头文件也贴上去
+本头文件的包含内容有：
+OY::_prefetch
+
+*/
+
+#ifdef _MSC_VER
+#include <immintrin.h>
+#endif
+
+namespace OY {
+    inline void _prefetch(const void *ptr) {
+#ifdef _MSC_VER
+        _mm_prefetch((const char *)ptr, _MM_HINT_T0);
+#else
+        __builtin_prefetch(ptr);
+#endif
+    }
+}
+
+#endif